@@ -20,6 +20,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Don't call io.Fonts->SetTexID() when io.Fonts is a shared immutable atlas (see ImFontAtlas::SetImmutable()): its owner sets it.
 //  2022-11-30: Renderer: Restoring using al_draw_indexed_prim() when Allegro version is >= 5.2.5.
 //  2022-10-11: Using 'nullptr' instead of 'NULL' as per our switch to C++11.
 //  2022-09-26: Inputs: Renamed ImGuiKey_ModXXX introduced in 1.87 to ImGuiMod_XXX (old names still supported).
@@ -260,8 +261,9 @@ bool ImGui_ImplAllegro5_CreateDeviceObjects()
     if (!cloned_img)
         return false;
 
-    // Store our identifier
-    io.Fonts->SetTexID((ImTextureID)(intptr_t)cloned_img);
+    // Store our identifier (unless the atlas is immutable: it is shared and its owner sets it)
+    if (!io.Fonts->IsImmutable())
+        io.Fonts->SetTexID((ImTextureID)(intptr_t)cloned_img);
     bd->Texture = cloned_img;
 
     // Create an invisible mouse cursor
@@ -279,7 +281,8 @@ void ImGui_ImplAllegro5_InvalidateDeviceObjects()
     ImGui_ImplAllegro5_Data* bd = ImGui_ImplAllegro5_GetBackendData();
     if (bd->Texture)
     {
-        io.Fonts->SetTexID(0);
+        if (!io.Fonts->IsImmutable())
+            io.Fonts->SetTexID(0);
         al_destroy_bitmap(bd->Texture);
         bd->Texture = nullptr;
     }
@@ -22,6 +22,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Don't call io.Fonts->SetTexID() when io.Fonts is a shared immutable atlas (see ImFontAtlas::SetImmutable()): its owner sets it.
 //  2022-10-11: Using 'nullptr' instead of 'NULL' as per our switch to C++11.
 //  2021-12-08: OpenGL: Fixed mishandling of the the ImDrawCmd::IdxOffset field! This is an old bug but it never had an effect until some internal rendering changes in 1.86.
 //  2021-06-29: Reorganized backend to pull data from a single structure to facilitate usage with multiple-contexts (all g_XXXX access changed to bd->XXXX).
@@ -262,8 +263,9 @@ bool ImGui_ImplOpenGL2_CreateFontsTexture()
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
-    // Store our identifier
-    io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    // Store our identifier (unless the atlas is immutable: it is shared and its owner sets it)
+    if (!io.Fonts->IsImmutable())
+        io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -278,7 +280,8 @@ void ImGui_ImplOpenGL2_DestroyFontsTexture()
     if (bd->FontTexture)
     {
         glDeleteTextures(1, &bd->FontTexture);
-        io.Fonts->SetTexID(0);
+        if (!io.Fonts->IsImmutable())
+            io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
     }
 }
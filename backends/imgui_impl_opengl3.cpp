@@ -6,6 +6,9 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [X] Renderer: Signed distance field fonts (ImDrawCmdFlags_SDF, fonts baked with ImFontConfig::SDF).
+//  [X] Renderer: Compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+//  [x] Renderer: Per draw list 32-bit indices for large meshes (ImGuiBackendFlags_RendererHasIdx32) (Desktop OpenGL and OpenGL ES 3.0, not ES 2.0).
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -22,6 +25,11 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Don't call io.Fonts->SetTexID() when io.Fonts is a shared immutable atlas (see ImFontAtlas::SetImmutable()): its owner sets it.
+//  2026-10-18: OpenGL: Added support for draw lists promoted to 32-bit indices (ImDrawList::IdxBuffer32), set ImGuiBackendFlags_RendererHasIdx32 (Desktop OpenGL and OpenGL ES 3.0).
+//  2026-10-18: OpenGL: Added support for the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT), set ImGuiBackendFlags_RendererHasCompactVtx.
+//  2026-10-18: OpenGL: On GL 3.2+, upload all draw lists into a single vertex/index buffer per frame and submit consecutive commands sharing the same state with glMultiDrawElementsBaseVertex(). Skip redundant glScissor()/glBindTexture() calls. Added ImGui_ImplOpenGL3_GetRenderStats().
+//  2026-10-18: OpenGL: Added support for signed distance field fonts: honor ImDrawCmdFlags_SDF with a 'UseSDF' fragment shader uniform, set ImGuiBackendFlags_RendererHasSDF.
 //  2023-11-08: OpenGL: Update GL3W based imgui_impl_opengl3_loader.h to load "libGL.so" instead of "libGL.so.1", accomodating for NetBSD systems having only "libGL.so.3" available. (#6983)
 //  2023-10-05: OpenGL: Rename symbols in our internal loader so that LTO compilation with another copy of gl3w is possible. (#6875, #6668, #4445)
 //  2023-06-20: OpenGL: Fixed erroneous use glGetIntegerv(GL_CONTEXT_PROFILE_MASK) on contexts lower than 3.2. (#6539, #6333)
@@ -222,6 +230,7 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationUseSDF;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
@@ -229,8 +238,18 @@ struct ImGui_ImplOpenGL3_Data
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
     bool            HasClipOrigin;
+    bool            HasMultiDraw;            // GL 3.2+: upload all draw lists into a single buffer, batch draws with glMultiDrawElementsBaseVertex()
     bool            UseBufferSubData;
 
+    // Single buffer upload and draw batching
+    ImVector<ImDrawVert>    VtxStaging;
+    ImVector<char>          IdxStaging;     // Draw lists may use 16-bit or 32-bit indices (see ImDrawList::GetIdxSize())
+    ImVector<GLsizei>       BatchCounts;
+    ImVector<const void*>   BatchIndices;
+    ImVector<GLint>         BatchBaseVertices;
+    GLenum                  BatchIdxType;
+    ImGui_ImplOpenGL3_RenderStats RenderStats;
+
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
 
@@ -330,7 +349,15 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
     if (bd->GlVersion >= 320)
+    {
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+        bd->HasMultiDraw = true;
+    }
+#endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSDF;            // We can honor the ImDrawCmdFlags_SDF flag, allowing for signed distance field fonts.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx;     // We can decode the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT).
+#ifndef IMGUI_IMPL_OPENGL_ES2
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdx32;          // We can render draw lists promoted to 32-bit indices (ImDrawList::IdxBuffer32). GL_UNSIGNED_INT indices are core in Desktop GL and ES 3.0, ES 2.0 needs an extension.
 #endif
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
@@ -381,7 +408,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasSDF | ImGuiBackendFlags_RendererHasCompactVtx | ImGuiBackendFlags_RendererHasIdx32);
     IM_DELETE(bd);
 }
 
@@ -434,16 +461,22 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float pos_scale = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); // Positions are fixed-point, fold the decoding into the projection matrix
+#else
+    const float pos_scale = 1.0f;
 #endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
-        { 0.0f,         0.0f,        -1.0f,   0.0f },
-        { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
+        { 2.0f/(R-L)*pos_scale, 0.0f,                  0.0f,   0.0f },
+        { 0.0f,                 2.0f/(T-B)*pos_scale,  0.0f,   0.0f },
+        { 0.0f,                 0.0f,                 -1.0f,   0.0f },
+        { (R+L)/(L-R),          (T+B)/(B-T),           0.0f,   1.0f },
     };
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
+    glUniform1i(bd->AttribLocationUseSDF, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
@@ -462,11 +495,52 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+// Draw lists are concatenated in our index buffer with their own index size, which needs to be aligned
+static inline int ImGui_ImplOpenGL3_AlignIdxOffset(int offset, int idx_size)
+{
+    return (offset + idx_size - 1) & ~(idx_size - 1);
+}
+
+// Submit draws queued by ImGui_ImplOpenGL3_RenderDrawData(), which all share the same state and index type
+static void ImGui_ImplOpenGL3_FlushDrawBatch(ImGui_ImplOpenGL3_Data* bd)
+{
+    const int batch_size = bd->BatchCounts.Size;
+    if (batch_size == 0)
+        return;
+    const GLenum idx_type = bd->BatchIdxType;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+    if (bd->HasMultiDraw && batch_size > 1)
+    {
+        GL_CALL(glMultiDrawElementsBaseVertex(GL_TRIANGLES, bd->BatchCounts.Data, idx_type, bd->BatchIndices.Data, (GLsizei)batch_size, bd->BatchBaseVertices.Data));
+        bd->RenderStats.DrawCallCount++;
+    }
+    else
+#endif
+    for (int n = 0; n < batch_size; n++)
+    {
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+        if (bd->GlVersion >= 320)
+            GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, bd->BatchCounts[n], idx_type, bd->BatchIndices[n], bd->BatchBaseVertices[n]));
+        else
+#endif
+        GL_CALL(glDrawElements(GL_TRIANGLES, bd->BatchCounts[n], idx_type, bd->BatchIndices[n]));
+        bd->RenderStats.DrawCallCount++;
+    }
+    bd->BatchCounts.resize(0);
+    bd->BatchIndices.resize(0);
+    bd->BatchBaseVertices.resize(0);
+}
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -532,40 +606,93 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
+    // Upload vertex/index buffers
+    // - OpenGL drivers are in a very sorry state nowadays....
+    //   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
+    //   of leaks on Intel GPU when using multi-viewports on Windows.
+    // - After this we kept hearing of various display corruptions issues. We started disabling on non-Intel GPU, but issues still got reported on Intel.
+    // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
+    //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
+    // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
+    // - With GL 3.2+ we can offset vertices with glDrawElementsBaseVertex(), so all draw lists are concatenated and uploaded with
+    //   a single glBufferData() call per buffer. Otherwise each draw list is uploaded and drawn in turn.
+    // - Index data of each draw list uses its own index size (see ImGuiBackendFlags_RendererHasIdx32), 32-bit indices are aligned to 4 bytes.
+    ImGui_ImplOpenGL3_RenderStats* stats = &bd->RenderStats;
+    memset(stats, 0, sizeof(*stats));
+    if (bd->HasMultiDraw)
+    {
+        const void* vtx_data = (draw_data->CmdListsCount == 1) ? draw_data->CmdLists[0]->VtxBuffer.Data : nullptr;
+        const void* idx_data = (draw_data->CmdListsCount == 1) ? draw_data->CmdLists[0]->GetIdxData() : nullptr;
+        int idx_buffer_size = 0;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            idx_buffer_size = ImGui_ImplOpenGL3_AlignIdxOffset(idx_buffer_size, draw_data->CmdLists[n]->GetIdxSize()) + draw_data->CmdLists[n]->GetIdxCount() * draw_data->CmdLists[n]->GetIdxSize();
+        if (draw_data->CmdListsCount > 1)
+        {
+            bd->VtxStaging.resize(draw_data->TotalVtxCount);
+            bd->IdxStaging.resize(idx_buffer_size);
+            ImDrawVert* vtx_dst = bd->VtxStaging.Data;
+            int idx_dst_offset = 0;
+            for (int n = 0; n < draw_data->CmdListsCount; n++)
+            {
+                const ImDrawList* cmd_list = draw_data->CmdLists[n];
+                idx_dst_offset = ImGui_ImplOpenGL3_AlignIdxOffset(idx_dst_offset, cmd_list->GetIdxSize());
+                memcpy(vtx_dst, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+                memcpy(bd->IdxStaging.Data + idx_dst_offset, cmd_list->GetIdxData(), (size_t)cmd_list->GetIdxCount() * cmd_list->GetIdxSize());
+                vtx_dst += cmd_list->VtxBuffer.Size;
+                idx_dst_offset += cmd_list->GetIdxCount() * cmd_list->GetIdxSize();
+            }
+            vtx_data = bd->VtxStaging.Data;
+            idx_data = bd->IdxStaging.Data;
+        }
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)draw_data->TotalVtxCount * (int)sizeof(ImDrawVert), (const GLvoid*)vtx_data, GL_STREAM_DRAW));
+        GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)idx_buffer_size, (const GLvoid*)idx_data, GL_STREAM_DRAW));
+        stats->BufferUploadCount += 2;
+    }
+
     // Render command lists
+    // We keep track of bound texture and scissor to skip redundant state changes. Consecutive commands sharing the same state are
+    // queued and submitted together: merged into a single draw when their indices are contiguous, or with glMultiDrawElementsBaseVertex().
+    bool use_sdf = false; // Mirror of the 'UseSDF' uniform, which is only updated when ImDrawCmdFlags_SDF changes between commands.
+    int use_sdf_changes = 0;
+    GLuint bound_texture = 0;
+    bool bound_texture_valid = false;
+    GLint bound_scissor[4] = { 0, 0, -1, -1 };
+    int global_vtx_offset = 0;
+    int global_idx_byte_offset = 0;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
-
-        // Upload vertex/index buffers
-        // - OpenGL drivers are in a very sorry state nowadays....
-        //   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
-        //   of leaks on Intel GPU when using multi-viewports on Windows.
-        // - After this we kept hearing of various display corruptions issues. We started disabling on non-Intel GPU, but issues still got reported on Intel.
-        // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
-        //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
-        // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
-        const GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
-        const GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->UseBufferSubData)
+        const int idx_size = cmd_list->GetIdxSize();
+        const GLenum idx_type = (idx_size == 2) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        if (bd->HasMultiDraw)
+            global_idx_byte_offset = ImGui_ImplOpenGL3_AlignIdxOffset(global_idx_byte_offset, idx_size);
+        else
         {
-            if (bd->VertexBufferSize < vtx_buffer_size)
+            const GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
+            const GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->GetIdxCount() * idx_size;
+            if (bd->UseBufferSubData)
             {
-                bd->VertexBufferSize = vtx_buffer_size;
-                GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, nullptr, GL_STREAM_DRAW));
+                if (bd->VertexBufferSize < vtx_buffer_size)
+                {
+                    bd->VertexBufferSize = vtx_buffer_size;
+                    GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, nullptr, GL_STREAM_DRAW));
+                    stats->BufferUploadCount++;
+                }
+                if (bd->IndexBufferSize < idx_buffer_size)
+                {
+                    bd->IndexBufferSize = idx_buffer_size;
+                    GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
+                    stats->BufferUploadCount++;
+                }
+                GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data));
+                GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)cmd_list->GetIdxData()));
             }
-            if (bd->IndexBufferSize < idx_buffer_size)
+            else
             {
-                bd->IndexBufferSize = idx_buffer_size;
-                GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
+                GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW));
+                GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)cmd_list->GetIdxData(), GL_STREAM_DRAW));
             }
-            GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data));
-            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data));
-        }
-        else
-        {
-            GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW));
-            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW));
+            stats->BufferUploadCount += 2;
         }
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
@@ -573,12 +700,22 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
             if (pcmd->UserCallback != nullptr)
             {
+                // Submit queued draws, and forget about bound state as the callback may change it
+                ImGui_ImplOpenGL3_FlushDrawBatch(bd);
+                bound_texture_valid = false;
+                bound_scissor[2] = -1;
+
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    use_sdf = false;
+                }
                 else
+                {
                     pcmd->UserCallback(cmd_list, pcmd);
+                }
             }
             else
             {
@@ -588,20 +725,67 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
-                // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
+                stats->DrawCmdCount++;
 
-                // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
-                if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                // Select signed distance field or regular texture sampling
+                const bool cmd_use_sdf = (pcmd->Flags & ImDrawCmdFlags_SDF) != 0;
+                if (cmd_use_sdf != use_sdf)
+                {
+                    ImGui_ImplOpenGL3_FlushDrawBatch(bd);
+                    use_sdf = cmd_use_sdf;
+                    GL_CALL(glUniform1i(bd->AttribLocationUseSDF, use_sdf ? 1 : 0));
+                    use_sdf_changes++;
+                }
+
+                // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
+                const GLint scissor[4] = { (GLint)clip_min.x, (GLint)((float)fb_height - clip_max.y), (GLint)(clip_max.x - clip_min.x), (GLint)(clip_max.y - clip_min.y) };
+                if (memcmp(scissor, bound_scissor, sizeof(scissor)) != 0)
+                {
+                    ImGui_ImplOpenGL3_FlushDrawBatch(bd);
+                    GL_CALL(glScissor(scissor[0], scissor[1], (GLsizei)scissor[2], (GLsizei)scissor[3]));
+                    memcpy(bound_scissor, scissor, sizeof(scissor));
+                    stats->ScissorCount++;
+                }
+
+                // Bind texture
+                const GLuint texture = (GLuint)(intptr_t)pcmd->GetTexID();
+                if (!bound_texture_valid || texture != bound_texture)
+                {
+                    ImGui_ImplOpenGL3_FlushDrawBatch(bd);
+                    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+                    bound_texture = texture;
+                    bound_texture_valid = true;
+                    stats->TextureBindCount++;
+                }
+
+                // Queue draw, extending the previous one if indices are contiguous
+                if (bd->BatchCounts.Size > 0 && bd->BatchIdxType != idx_type)
+                    ImGui_ImplOpenGL3_FlushDrawBatch(bd);
+                const GLint base_vertex = (GLint)pcmd->VtxOffset + (bd->HasMultiDraw ? global_vtx_offset : 0);
+                const intptr_t idx_byte_offset = (intptr_t)pcmd->IdxOffset * idx_size + (bd->HasMultiDraw ? global_idx_byte_offset : 0);
+                const int last = bd->BatchCounts.Size - 1;
+                if (last >= 0 && bd->BatchBaseVertices[last] == base_vertex && (intptr_t)bd->BatchIndices[last] + (intptr_t)bd->BatchCounts[last] * idx_size == idx_byte_offset)
+                {
+                    bd->BatchCounts[last] += (GLsizei)pcmd->ElemCount;
+                }
                 else
-#endif
-                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+                {
+                    bd->BatchIdxType = idx_type;
+                    bd->BatchCounts.push_back((GLsizei)pcmd->ElemCount);
+                    bd->BatchIndices.push_back((const void*)idx_byte_offset);
+                    bd->BatchBaseVertices.push_back(base_vertex);
+                }
             }
         }
+
+        // Submit queued draws before the next draw list overwrites our buffers
+        if (!bd->HasMultiDraw)
+            ImGui_ImplOpenGL3_FlushDrawBatch(bd);
+        global_vtx_offset += cmd_list->VtxBuffer.Size;
+        global_idx_byte_offset += cmd_list->GetIdxCount() * idx_size;
     }
+    ImGui_ImplOpenGL3_FlushDrawBatch(bd);
+    stats->GLCallCount = stats->BufferUploadCount + stats->DrawCallCount + stats->TextureBindCount + stats->ScissorCount + use_sdf_changes;
 
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
@@ -679,8 +863,9 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
 #endif
     GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
 
-    // Store our identifier
-    io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    // Store our identifier (unless the atlas is immutable: it is shared and its owner sets it)
+    if (!io.Fonts->IsImmutable())
+        io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
 
     // Restore state
     GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
@@ -688,6 +873,13 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     return true;
 }
 
+void ImGui_ImplOpenGL3_GetRenderStats(ImGui_ImplOpenGL3_RenderStats* out_stats)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplOpenGL3_Init()?");
+    *out_stats = bd->RenderStats;
+}
+
 void ImGui_ImplOpenGL3_DestroyFontsTexture()
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -695,7 +887,8 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     if (bd->FontTexture)
     {
         glDeleteTextures(1, &bd->FontTexture);
-        io.Fonts->SetTexID(0);
+        if (!io.Fonts->IsImmutable())
+            io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
     }
 }
@@ -812,47 +1005,86 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
 
+    // Fragment shaders
+    // - When 'UseSDF' is set (ImDrawCmdFlags_SDF), texture alpha is a signed distance field with the glyph outline at 0.5:
+    //   we convert it to coverage with a screen-space anti-aliasing width, which keeps text sharp at any scale.
+    // - GLSL ES 1.00 needs GL_OES_standard_derivatives for fwidth(), we fallback to a fixed width without it.
     const GLchar* fragment_shader_glsl_120 =
         "#ifdef GL_ES\n"
+        "#ifdef GL_OES_standard_derivatives\n"
+        "#extension GL_OES_standard_derivatives : enable\n"
+        "#endif\n"
         "    precision mediump float;\n"
         "#endif\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool UseSDF;\n"
         "varying vec2 Frag_UV;\n"
         "varying vec4 Frag_Color;\n"
         "void main()\n"
         "{\n"
-        "    gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture2D(Texture, Frag_UV.st);\n"
+        "    if (UseSDF)\n"
+        "    {\n"
+        "#if defined(GL_ES) && !defined(GL_OES_standard_derivatives)\n"
+        "        float w = 0.1;\n"
+        "#else\n"
+        "        float w = max(0.5 * fwidth(tex_color.a), 0.0001);\n"
+        "#endif\n"
+        "        tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    gl_FragColor = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_130 =
         "uniform sampler2D Texture;\n"
+        "uniform bool UseSDF;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (UseSDF)\n"
+        "    {\n"
+        "        float w = max(0.5 * fwidth(tex_color.a), 0.0001);\n"
+        "        tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool UseSDF;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (UseSDF)\n"
+        "    {\n"
+        "        float w = max(0.5 * fwidth(tex_color.a), 0.0001);\n"
+        "        tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool UseSDF;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_color = texture(Texture, Frag_UV.st);\n"
+        "    if (UseSDF)\n"
+        "    {\n"
+        "        float w = max(0.5 * fwidth(tex_color.a), 0.0001);\n"
+        "        tex_color.a = smoothstep(0.5 - w, 0.5 + w, tex_color.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_color;\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
@@ -906,6 +1138,7 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+    bd->AttribLocationUseSDF = glGetUniformLocation(bd->ShaderHandle, "UseSDF");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
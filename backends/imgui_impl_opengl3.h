@@ -6,6 +6,8 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [X] Renderer: Compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+//  [x] Renderer: Per draw list 32-bit indices for large meshes (ImGuiBackendFlags_RendererHasIdx32) (Desktop OpenGL and OpenGL ES 3.0, not ES 2.0).
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -35,6 +37,18 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_NewFrame();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data);
 
+// (Optional) Statistics for the last call to ImGui_ImplOpenGL3_RenderDrawData(), e.g. to compare drivers or measure the effect of batching.
+struct ImGui_ImplOpenGL3_RenderStats
+{
+    int         GLCallCount;            // GL calls issued to upload and draw (excluding the fixed cost of backing up, setting up and restoring state)
+    int         BufferUploadCount;      // glBufferData()/glBufferSubData() calls. With GL 3.2+ all draw lists are uploaded at once.
+    int         DrawCmdCount;           // Non-callback ImDrawCmd processed (excluding fully clipped ones)
+    int         DrawCallCount;          // glDrawElements()/glDrawElementsBaseVertex()/glMultiDrawElementsBaseVertex() calls
+    int         TextureBindCount;       // glBindTexture() calls, redundant binds are skipped
+    int         ScissorCount;           // glScissor() calls, redundant changes are skipped
+};
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_GetRenderStats(ImGui_ImplOpenGL3_RenderStats* out_stats);
+
 // (Optional) Called by Init/NewFrame/Shutdown
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_CreateFontsTexture();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyFontsTexture();
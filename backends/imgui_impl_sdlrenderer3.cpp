@@ -10,6 +10,7 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'SDL_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h), decoded on the CPU.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -20,6 +21,8 @@
 // - Introduction, links and more at the top of imgui.cpp
 
 // CHANGELOG
+//  2026-10-18: Don't call io.Fonts->SetTexID() when io.Fonts is a shared immutable atlas (see ImFontAtlas::SetImmutable()): its owner sets it.
+//  2026-10-18: Added support for the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT), set ImGuiBackendFlags_RendererHasCompactVtx.
 //  2023-05-30: Initial version.
 
 #include "imgui.h"
@@ -44,6 +47,9 @@ struct ImGui_ImplSDLRenderer3_Data
 {
     SDL_Renderer*   SDLRenderer;
     SDL_Texture*    FontTexture;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImVector<ImVec2> DecodedVtx;    // Interleaved pos/uv: SDL_RenderGeometryRaw() only takes float positions and UV
+#endif
     ImGui_ImplSDLRenderer3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
 
@@ -66,6 +72,7 @@ bool ImGui_ImplSDLRenderer3_Init(SDL_Renderer* renderer)
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_sdlrenderer3";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx; // We can decode the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT).
 
     bd->SDLRenderer = renderer;
 
@@ -82,7 +89,7 @@ void ImGui_ImplSDLRenderer3_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasCompactVtx);
     IM_DELETE(bd);
 }
 
@@ -148,6 +155,14 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data)
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
         const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data;
         const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        bd->DecodedVtx.resize(cmd_list->VtxBuffer.Size * 2);
+        for (int vtx_i = 0; vtx_i < cmd_list->VtxBuffer.Size; vtx_i++)
+        {
+            bd->DecodedVtx.Data[vtx_i * 2 + 0] = vtx_buffer[vtx_i].pos;
+            bd->DecodedVtx.Data[vtx_i * 2 + 1] = vtx_buffer[vtx_i].uv;
+        }
+#endif
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -176,8 +191,15 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data)
                 SDL_Rect r = { (int)(clip_min.x), (int)(clip_min.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
                 SDL_SetRenderClipRect(bd->SDLRenderer, &r);
 
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                const float* xy = &bd->DecodedVtx.Data[pcmd->VtxOffset * 2 + 0].x;
+                const float* uv = &bd->DecodedVtx.Data[pcmd->VtxOffset * 2 + 1].x;
+                const int xy_uv_stride = (int)sizeof(ImVec2) * 2;
+#else
                 const float* xy = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, pos));
                 const float* uv = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, uv));
+                const int xy_uv_stride = (int)sizeof(ImDrawVert);
+#endif
 #if SDL_VERSION_ATLEAST(2,0,19)
                 const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.19+
 #else
@@ -187,9 +209,9 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data)
                 // Bind texture, Draw
 				SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
                 SDL_RenderGeometryRaw(bd->SDLRenderer, tex,
-                    xy, (int)sizeof(ImDrawVert),
+                    xy, xy_uv_stride,
                     color, (int)sizeof(ImDrawVert),
-                    uv, (int)sizeof(ImDrawVert),
+                    uv, xy_uv_stride,
                     cmd_list->VtxBuffer.Size - pcmd->VtxOffset,
                     idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
             }
@@ -224,8 +246,9 @@ bool ImGui_ImplSDLRenderer3_CreateFontsTexture()
     SDL_SetTextureBlendMode(bd->FontTexture, SDL_BLENDMODE_BLEND);
     SDL_SetTextureScaleMode(bd->FontTexture, SDL_SCALEMODE_LINEAR);
 
-    // Store our identifier
-    io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+    // Store our identifier (unless the atlas is immutable: it is shared and its owner sets it)
+    if (!io.Fonts->IsImmutable())
+        io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
 
     return true;
 }
@@ -236,7 +259,8 @@ void ImGui_ImplSDLRenderer3_DestroyFontsTexture()
     ImGui_ImplSDLRenderer3_Data* bd = ImGui_ImplSDLRenderer3_GetBackendData();
     if (bd->FontTexture)
     {
-        io.Fonts->SetTexID(0);
+        if (!io.Fonts->IsImmutable())
+            io.Fonts->SetTexID(0);
         SDL_DestroyTexture(bd->FontTexture);
         bd->FontTexture = nullptr;
     }
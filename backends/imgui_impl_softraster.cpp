@@ -0,0 +1,824 @@
+// dear imgui: Renderer Backend for a CPU software rasterizer
+// (No graphics API required: renders ImDrawData into a 32-bit framebuffer in system memory. Useful for headless servers, CI, thumbnails.)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded tile-based rasterization (see 'threads_count' parameter of ImGui_ImplSoftRaster_Init()).
+//  [X] Renderer: Compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+// Missing features:
+//  [ ] Renderer: No support for ImDrawCmdFlags_SDF (fonts baked with ImFontConfig::SDF).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-18: Don't convert the font atlas nor call SetTexID() when io.Fonts is a shared immutable atlas: its owner sets up the texture.
+//  2026-10-18: Added support for the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT), set ImGuiBackendFlags_RendererHasCompactVtx.
+//  2026-10-18: Initial version.
+
+// How it works:
+// - Draw commands are converted into primitives, clipped to their ClipRect. Axis-aligned quads (which are the vast majority
+//   of Dear ImGui geometry: text glyphs, filled rectangles, images) are detected and blitted directly. Other triangles go through
+//   a half-space rasterizer with 4 bits of sub-pixel precision and a top-left fill rule, so shared edges are never blended twice.
+// - Primitives are binned into 64x64 tiles which are rasterized in parallel by worker threads (the calling thread helps).
+//   A tile is always processed by a single thread and primitives are drawn in submission order: output doesn't depend on threads count.
+// - Blending matches the other renderer backends: rgb = src.rgb * src.a + dst.rgb * (1 - src.a), a = src.a + dst.a * (1 - src.a).
+// - Solid spans are blended 4 pixels at a time with SSE2 when available.
+// - Textures are sampled with bilinear filtering, except for quads mapping texels 1:1 to pixels (e.g. text) which copy texels directly.
+// - User callbacks are supported: everything submitted before the callback is rasterized before it is called.
+// - #define IMGUI_IMPL_SOFTRASTER_NO_THREADS to disable the use of <thread> (everything is rasterized on the calling thread).
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_softraster.h"
+#include <math.h>       // floorf, ceilf
+#include <string.h>     // memset
+#ifndef IMGUI_IMPL_SOFTRASTER_NO_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// Enable SSE2 intrinsics if available
+#if (defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_IMPL_SOFTRASTER_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#pragma clang diagnostic ignored "-Wcast-align"         // warning: cast from 'char *' to 'ImU32 *' increases required alignment
+#endif
+
+#define IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT   6       // 64x64 pixels tiles
+#define IMGUI_IMPL_SOFTRASTER_TILE_SIZE         (1 << IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT)
+#define IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS     4       // Vertex positions are snapped to 1/16th of a pixel
+#define IMGUI_IMPL_SOFTRASTER_MAX_THREADS       64
+
+enum ImGui_ImplSoftRaster_PrimType
+{
+    ImGui_ImplSoftRaster_PrimType_QuadSolid,            // Axis-aligned quad with a single color
+    ImGui_ImplSoftRaster_PrimType_QuadTextured,         // Axis-aligned quad with a single color, sampling a texture
+    ImGui_ImplSoftRaster_PrimType_Triangle,             // Anything else
+};
+
+// A primitive ready to be rasterized
+struct ImGui_ImplSoftRaster_Prim
+{
+    int         MinX, MinY, MaxX, MaxY;                 // Covered pixels, clipped to ClipRect and framebuffer (max is exclusive)
+    ImGui_ImplSoftRaster_PrimType Type;
+    ImU32       Col;                                    // Quads: vertex color (already modulated by the texel for QuadSolid)
+    const ImGui_ImplSoftRaster_Texture* Tex;
+    float       U, V, DuDx, DvDy;                       // QuadTextured: UV at the center of pixel (0,0) and UV increment per pixel
+    bool        TexelCopy;                              // QuadTextured: 1:1 mapping, read texel (x + TexelOffX, y + TexelOffY)
+    int         TexelOffX, TexelOffY;
+    int         TriIndex;                               // Triangle: index in bd->Tris[]
+};
+
+// Triangle setup
+struct ImGui_ImplSoftRaster_Tri
+{
+    ImS64       EdgeA[3], EdgeB[3], EdgeC[3];           // Edge functions E(x,y) = A*x + B*y + C for the center of pixel (x,y). Pixel is inside when all are >= 0.
+    float       Attr[6][3];                             // R,G,B,A,U,V planes: value at the center of pixel (0,0), d/dx, d/dy
+    ImU32       Col;                                    // Color when !HasGradient && !HasUV
+    bool        HasGradient;                            // Vertex colors differ
+    bool        HasUV;                                  // UV differ (otherwise the texel was folded into vertex colors)
+};
+
+// Software rasterizer data
+struct ImGui_ImplSoftRaster_Data
+{
+    ImGui_ImplSoftRaster_Texture        FontTexture;
+    ImVector<ImU32>                     FontPixels;
+    int                                 ThreadsCount;
+
+    // Current framebuffer and batch of primitives
+    ImU32*                              FbPixels;
+    int                                 FbWidth;
+    int                                 FbHeight;
+    int                                 FbStride;
+    int                                 TilesCountX;
+    int                                 TilesCountY;
+    ImVector<ImGui_ImplSoftRaster_Prim> Prims;
+    ImVector<ImGui_ImplSoftRaster_Tri>  Tris;
+    ImVector<int>                       TileBinStart;   // [TilesCount + 1] Offset of each tile in TileBins[]
+    ImVector<int>                       TileBinCursor;  // [TilesCount] Temporary, used while binning
+    ImVector<int>                       TileBins;       // Indices in Prims[] for each tile, in submission order
+    ImVector<int>                       ActiveTiles;    // Tiles with at least one primitive
+
+#ifndef IMGUI_IMPL_SOFTRASTER_NO_THREADS
+    ImVector<std::thread*>              Workers;
+    std::mutex                          Mutex;
+    std::condition_variable             JobCond;        // Signaled when a new job is available (or on shutdown)
+    std::condition_variable             DoneCond;       // Signaled when the last worker finished the job
+    int                                 JobGeneration;
+    int                                 WorkersBusy;
+    bool                                WorkersQuit;
+    std::atomic<int>                    NextActiveTile;
+#endif
+
+    ImGui_ImplSoftRaster_Data()
+    {
+        memset((void*)&FontTexture, 0, sizeof(FontTexture));
+        ThreadsCount = 1;
+        FbPixels = nullptr;
+        FbWidth = FbHeight = FbStride = 0;
+        TilesCountX = TilesCountY = 0;
+#ifndef IMGUI_IMPL_SOFTRASTER_NO_THREADS
+        JobGeneration = 0;
+        WorkersBusy = 0;
+        WorkersQuit = false;
+        NextActiveTile = 0;
+#endif
+    }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftRaster_Data* ImGui_ImplSoftRaster_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftRaster_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Pixel helpers
+//-----------------------------------------------------------------------------
+
+static inline int ImGui_ImplSoftRaster_Min(int a, int b) { return a < b ? a : b; }
+static inline int ImGui_ImplSoftRaster_Max(int a, int b) { return a > b ? a : b; }
+static inline ImS64 ImGui_ImplSoftRaster_MinS64(ImS64 a, ImS64 b) { return a < b ? a : b; }
+static inline ImS64 ImGui_ImplSoftRaster_MaxS64(ImS64 a, ImS64 b) { return a > b ? a : b; }
+
+// (v + 127) / 255 for v in [0, 255*255], without division
+static inline ImU32 ImGui_ImplSoftRaster_Div255(ImU32 v)
+{
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+// Multiply two colors per channel (texel * vertex color)
+static inline ImU32 ImGui_ImplSoftRaster_MulColors(ImU32 a, ImU32 b)
+{
+    if (a == 0xFFFFFFFF)
+        return b;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoftRaster_Div255(((a >> shift) & 0xFF) * ((b >> shift) & 0xFF)) << shift;
+    return out;
+}
+
+// Blend 'src' over 'dst'. Two channels are processed at once in each 16-bit lane.
+// Alpha is replaced by 255 in the source so the alpha channel computes src.a + dst.a * (1 - src.a).
+static inline ImU32 ImGui_ImplSoftRaster_BlendPixel(ImU32 dst, ImU32 src)
+{
+    const ImU32 a = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 0)
+        return dst;
+    if (a == 255)
+        return src;
+    const ImU32 inv_a = 255 - a;
+    const ImU32 s = src | IM_COL32_A_MASK;
+    ImU32 rb = (s & 0x00FF00FF) * a + (dst & 0x00FF00FF) * inv_a + 0x00800080;
+    ImU32 ga = ((s >> 8) & 0x00FF00FF) * a + ((dst >> 8) & 0x00FF00FF) * inv_a + 0x00800080;
+    rb = ((rb + ((rb >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+    ga = ((ga + ((ga >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+    return rb | (ga << 8);
+}
+
+// Fill or blend a span of pixels with a single color
+static void ImGui_ImplSoftRaster_FillSpan(ImU32* dst, int count, ImU32 col)
+{
+    const ImU32 a = (col >> IM_COL32_A_SHIFT) & 0xFF;
+    if (a == 0)
+        return;
+    if (a == 255)
+    {
+        for (int n = 0; n < count; n++)
+            dst[n] = col;
+        return;
+    }
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE2
+    if (count >= 4)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i src_term = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32((int)(col | IM_COL32_A_MASK)), zero), _mm_set1_epi16((short)a)), _mm_set1_epi16(128));
+        const __m128i inv_a = _mm_set1_epi16((short)(255 - a));
+        for (; count >= 4; count -= 4, dst += 4)
+        {
+            const __m128i d = _mm_loadu_si128((const __m128i*)(void*)dst);
+            __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv_a), src_term);
+            __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv_a), src_term);
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+            _mm_storeu_si128((__m128i*)(void*)dst, _mm_packus_epi16(lo, hi));
+        }
+    }
+#endif
+    for (int n = 0; n < count; n++)
+        dst[n] = ImGui_ImplSoftRaster_BlendPixel(dst[n], col);
+}
+
+// Bilinear sampling with clamp-to-edge addressing
+static ImU32 ImGui_ImplSoftRaster_SampleBilinear(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    const float tx = u * (float)tex->Width - 0.5f;
+    const float ty = v * (float)tex->Height - 0.5f;
+    const float fx = floorf(tx);
+    const float fy = floorf(ty);
+    const int wx = (int)((tx - fx) * 256.0f);
+    const int wy = (int)((ty - fy) * 256.0f);
+    const int x0 = ImGui_ImplSoftRaster_Max(0, ImGui_ImplSoftRaster_Min((int)fx, tex->Width - 1));
+    const int y0 = ImGui_ImplSoftRaster_Max(0, ImGui_ImplSoftRaster_Min((int)fy, tex->Height - 1));
+    const int x1 = ImGui_ImplSoftRaster_Max(0, ImGui_ImplSoftRaster_Min((int)fx + 1, tex->Width - 1));
+    const int y1 = ImGui_ImplSoftRaster_Max(0, ImGui_ImplSoftRaster_Min((int)fy + 1, tex->Height - 1));
+    const ImU32 c00 = tex->Pixels[y0 * tex->Width + x0];
+    const ImU32 c10 = tex->Pixels[y0 * tex->Width + x1];
+    const ImU32 c01 = tex->Pixels[y1 * tex->Width + x0];
+    const ImU32 c11 = tex->Pixels[y1 * tex->Width + x1];
+    if (c00 == c10 && c00 == c01 && c00 == c11)
+        return c00;
+    const int w00 = (256 - wx) * (256 - wy), w10 = wx * (256 - wy), w01 = (256 - wx) * wy, w11 = wx * wy;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        const int c = (int)((c00 >> shift) & 0xFF) * w00 + (int)((c10 >> shift) & 0xFF) * w10 + (int)((c01 >> shift) & 0xFF) * w01 + (int)((c11 >> shift) & 0xFF) * w11;
+        out |= (ImU32)((c + 32768) >> 16) << shift;
+    }
+    return out;
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_PackColor(float r, float g, float b, float a)
+{
+    // Attributes are interpolated in [0,255], clamp to avoid wrapping on the edges of triangles
+    r = r < 0.0f ? 0.0f : r > 255.0f ? 255.0f : r;
+    g = g < 0.0f ? 0.0f : g > 255.0f ? 255.0f : g;
+    b = b < 0.0f ? 0.0f : b > 255.0f ? 255.0f : b;
+    a = a < 0.0f ? 0.0f : a > 255.0f ? 255.0f : a;
+    return IM_COL32((int)(r + 0.5f), (int)(g + 0.5f), (int)(b + 0.5f), (int)(a + 0.5f));
+}
+
+//-----------------------------------------------------------------------------
+// Primitive setup
+//-----------------------------------------------------------------------------
+
+// Try to recognize an axis-aligned quad as emitted by ImDrawList::PrimRect()/PrimRectUV(): indices (a,b,c,a,c,d) with
+// a=(x0,y0) b=(x1,y0) c=(x1,y1) d=(x0,y1), UV following the same pattern and a single color.
+static bool ImGui_ImplSoftRaster_AddQuad(ImGui_ImplSoftRaster_Data* bd, const ImDrawVert* vtx, const ImDrawIdx* idx, const ImGui_ImplSoftRaster_Texture* tex, const ImVec2& off, const ImVec2& scale, int clip_x0, int clip_y0, int clip_x1, int clip_y1)
+{
+    if (idx[3] != idx[0] || idx[4] != idx[2])
+        return false;
+    const ImDrawVert& a = vtx[idx[0]];
+    const ImDrawVert& b = vtx[idx[1]];
+    const ImDrawVert& c = vtx[idx[2]];
+    const ImDrawVert& d = vtx[idx[5]];
+    const ImVec2 a_pos = a.pos, b_pos = b.pos, c_pos = c.pos, d_pos = d.pos; // Decode (no-op unless IMGUI_USE_COMPACT_DRAWVERT is enabled)
+    const ImVec2 a_uv = a.uv, b_uv = b.uv, c_uv = c.uv, d_uv = d.uv;
+    if (a_pos.y != b_pos.y || b_pos.x != c_pos.x || c_pos.y != d_pos.y || d_pos.x != a_pos.x || a_pos.x >= c_pos.x || a_pos.y >= c_pos.y)
+        return false;
+    if (a_uv.y != b_uv.y || b_uv.x != c_uv.x || c_uv.y != d_uv.y || d_uv.x != a_uv.x)
+        return false;
+    if (a.col != b.col || a.col != c.col || a.col != d.col)
+        return false;
+
+    // Pixel centers inside [x0,x1) x [y0,y1) are covered, consistent with the top-left rule used for triangles
+    const float x0 = (a_pos.x - off.x) * scale.x, y0 = (a_pos.y - off.y) * scale.y;
+    const float x1 = (c_pos.x - off.x) * scale.x, y1 = (c_pos.y - off.y) * scale.y;
+    ImGui_ImplSoftRaster_Prim prim;
+    prim.MinX = ImGui_ImplSoftRaster_Max((int)ceilf(x0 - 0.5f), clip_x0);
+    prim.MinY = ImGui_ImplSoftRaster_Max((int)ceilf(y0 - 0.5f), clip_y0);
+    prim.MaxX = ImGui_ImplSoftRaster_Min((int)ceilf(x1 - 0.5f), clip_x1);
+    prim.MaxY = ImGui_ImplSoftRaster_Min((int)ceilf(y1 - 0.5f), clip_y1);
+    if (prim.MinX >= prim.MaxX || prim.MinY >= prim.MaxY || (a.col & IM_COL32_A_MASK) == 0)
+        return true;
+    prim.Tex = tex;
+    prim.TriIndex = -1;
+    prim.TexelCopy = false;
+    prim.TexelOffX = prim.TexelOffY = 0;
+    if (a_uv.x == c_uv.x && a_uv.y == c_uv.y)
+    {
+        prim.Type = ImGui_ImplSoftRaster_PrimType_QuadSolid;
+        prim.Col = ImGui_ImplSoftRaster_MulColors(ImGui_ImplSoftRaster_SampleBilinear(tex, a_uv.x, a_uv.y), a.col);
+        prim.U = prim.V = prim.DuDx = prim.DvDy = 0.0f;
+    }
+    else
+    {
+        prim.Type = ImGui_ImplSoftRaster_PrimType_QuadTextured;
+        prim.Col = a.col;
+        prim.DuDx = (c_uv.x - a_uv.x) / (x1 - x0);
+        prim.DvDy = (c_uv.y - a_uv.y) / (y1 - y0);
+        prim.U = a_uv.x + (0.5f - x0) * prim.DuDx;
+        prim.V = a_uv.y + (0.5f - y0) * prim.DvDy;
+
+        // Detect 1:1 texel mapping with texel centers aligned on pixel centers, in which case bilinear filtering is a plain copy
+        const float texels_per_pixel_x = prim.DuDx * (float)tex->Width;
+        const float texels_per_pixel_y = prim.DvDy * (float)tex->Height;
+        const float tx = (prim.U + prim.DuDx * (float)prim.MinX) * (float)tex->Width - 0.5f;
+        const float ty = (prim.V + prim.DvDy * (float)prim.MinY) * (float)tex->Height - 0.5f;
+        const float tx_rounded = floorf(tx + 0.5f);
+        const float ty_rounded = floorf(ty + 0.5f);
+        const float eps = 1.0f / 256.0f;
+        if (fabsf(texels_per_pixel_x - 1.0f) < eps && fabsf(texels_per_pixel_y - 1.0f) < eps && fabsf(tx - tx_rounded) < eps && fabsf(ty - ty_rounded) < eps)
+        {
+            prim.TexelOffX = (int)tx_rounded - prim.MinX;
+            prim.TexelOffY = (int)ty_rounded - prim.MinY;
+            prim.TexelCopy = (prim.MinX + prim.TexelOffX >= 0 && prim.MaxX + prim.TexelOffX <= tex->Width && prim.MinY + prim.TexelOffY >= 0 && prim.MaxY + prim.TexelOffY <= tex->Height);
+        }
+    }
+    bd->Prims.push_back(prim);
+    return true;
+}
+
+static void ImGui_ImplSoftRaster_AddTriangle(ImGui_ImplSoftRaster_Data* bd, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, const ImGui_ImplSoftRaster_Texture* tex, const ImVec2& off, const ImVec2& scale, int clip_x0, int clip_y0, int clip_x1, int clip_y1)
+{
+    // Snap to sub-pixel grid. Edge functions are computed exactly in 64-bit integers.
+    const float subpixel_scale = (float)(1 << IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS);
+    ImS64 fx[3], fy[3];
+    const ImDrawVert* v[3] = { v0, v1, v2 };
+    for (int n = 0; n < 3; n++)
+    {
+        const ImVec2 pos = v[n]->pos;
+        fx[n] = (ImS64)floorf((pos.x - off.x) * scale.x * subpixel_scale + 0.5f);
+        fy[n] = (ImS64)floorf((pos.y - off.y) * scale.y * subpixel_scale + 0.5f);
+    }
+    ImS64 area = (fx[1] - fx[0]) * (fy[2] - fy[0]) - (fy[1] - fy[0]) * (fx[2] - fx[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        ImS64 tmp;
+        tmp = fx[1]; fx[1] = fx[2]; fx[2] = tmp;
+        tmp = fy[1]; fy[1] = fy[2]; fy[2] = tmp;
+        const ImDrawVert* tmp_v = v[1]; v[1] = v[2]; v[2] = tmp_v;
+        area = -area;
+    }
+
+    ImGui_ImplSoftRaster_Prim prim;
+    ImS64 min_fx = fx[0], max_fx = fx[0], min_fy = fy[0], max_fy = fy[0];
+    for (int n = 1; n < 3; n++)
+    {
+        min_fx = ImGui_ImplSoftRaster_MinS64(min_fx, fx[n]); max_fx = ImGui_ImplSoftRaster_MaxS64(max_fx, fx[n]);
+        min_fy = ImGui_ImplSoftRaster_MinS64(min_fy, fy[n]); max_fy = ImGui_ImplSoftRaster_MaxS64(max_fy, fy[n]);
+    }
+    prim.MinX = ImGui_ImplSoftRaster_Max((int)(min_fx >> IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS), clip_x0);
+    prim.MinY = ImGui_ImplSoftRaster_Max((int)(min_fy >> IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS), clip_y0);
+    prim.MaxX = ImGui_ImplSoftRaster_Min((int)(max_fx >> IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS) + 1, clip_x1);
+    prim.MaxY = ImGui_ImplSoftRaster_Min((int)(max_fy >> IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS) + 1, clip_y1);
+    if (prim.MinX >= prim.MaxX || prim.MinY >= prim.MaxY)
+        return;
+    if (((v[0]->col | v[1]->col | v[2]->col) & IM_COL32_A_MASK) == 0)
+        return;
+
+    ImGui_ImplSoftRaster_Tri tri;
+    const ImS64 half_pixel = 1 << (IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS - 1);
+    for (int n = 0; n < 3; n++)
+    {
+        // E(p) = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x), evaluated at p = pixel * subpixel_scale + half_pixel
+        const int n2 = (n + 1) % 3;
+        const ImS64 dx = fx[n2] - fx[n];
+        const ImS64 dy = fy[n2] - fy[n];
+        tri.EdgeA[n] = -dy * (1 << IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS);
+        tri.EdgeB[n] = dx * (1 << IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS);
+        tri.EdgeC[n] = dx * (half_pixel - fy[n]) - dy * (half_pixel - fx[n]);
+
+        // Top-left rule: pixels exactly on an edge belong to one side only. The test is antisymmetric so an edge shared by two triangles goes to exactly one of them.
+        const bool owns_edge = (dy > 0 || (dy == 0 && dx < 0));
+        if (!owns_edge)
+            tri.EdgeC[n] -= 1;
+    }
+
+    // Attribute planes
+    const float x0 = (float)fx[0] / subpixel_scale, y0 = (float)fy[0] / subpixel_scale;
+    const float x10 = (float)(fx[1] - fx[0]) / subpixel_scale, y10 = (float)(fy[1] - fy[0]) / subpixel_scale;
+    const float x20 = (float)(fx[2] - fx[0]) / subpixel_scale, y20 = (float)(fy[2] - fy[0]) / subpixel_scale;
+    const float inv_det = 1.0f / (x10 * y20 - x20 * y10);
+    const ImVec2 uv[3] = { v[0]->uv, v[1]->uv, v[2]->uv };
+    tri.HasUV = (uv[0].x != uv[1].x || uv[0].x != uv[2].x || uv[0].y != uv[1].y || uv[0].y != uv[2].y);
+    ImU32 col[3];
+    if (tri.HasUV)
+    {
+        for (int n = 0; n < 3; n++)
+            col[n] = v[n]->col;
+    }
+    else
+    {
+        // Constant UV: sample once and fold the texel into vertex colors
+        const ImU32 texel = ImGui_ImplSoftRaster_SampleBilinear(tex, uv[0].x, uv[0].y);
+        for (int n = 0; n < 3; n++)
+            col[n] = ImGui_ImplSoftRaster_MulColors(texel, v[n]->col);
+    }
+    tri.HasGradient = (col[0] != col[1] || col[0] != col[2]);
+    tri.Col = col[0];
+    for (int attr = 0; attr < 6; attr++)
+    {
+        float a[3];
+        for (int n = 0; n < 3; n++)
+            a[n] = (attr < 4) ? (float)((col[n] >> (attr == 0 ? IM_COL32_R_SHIFT : attr == 1 ? IM_COL32_G_SHIFT : attr == 2 ? IM_COL32_B_SHIFT : IM_COL32_A_SHIFT)) & 0xFF) : (attr == 4) ? uv[n].x : uv[n].y;
+        const float dadx = ((a[1] - a[0]) * y20 - (a[2] - a[0]) * y10) * inv_det;
+        const float dady = ((a[2] - a[0]) * x10 - (a[1] - a[0]) * x20) * inv_det;
+        tri.Attr[attr][0] = a[0] + dadx * (0.5f - x0) + dady * (0.5f - y0);
+        tri.Attr[attr][1] = dadx;
+        tri.Attr[attr][2] = dady;
+    }
+
+    prim.Type = ImGui_ImplSoftRaster_PrimType_Triangle;
+    prim.Col = tri.Col;
+    prim.Tex = tex;
+    prim.U = prim.V = prim.DuDx = prim.DvDy = 0.0f;
+    prim.TexelCopy = false;
+    prim.TexelOffX = prim.TexelOffY = 0;
+    prim.TriIndex = bd->Tris.Size;
+    bd->Tris.push_back(tri);
+    bd->Prims.push_back(prim);
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoftRaster_RasterizeQuadTextured(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_Prim& prim, int x0, int y0, int x1, int y1)
+{
+    const ImGui_ImplSoftRaster_Texture* tex = prim.Tex;
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* dst = (ImU32*)(void*)((char*)bd->FbPixels + (size_t)y * (size_t)bd->FbStride);
+        if (prim.TexelCopy)
+        {
+            const ImU32* src = tex->Pixels + (size_t)(y + prim.TexelOffY) * (size_t)tex->Width + prim.TexelOffX;
+            for (int x = x0; x < x1; x++)
+                if (src[x] & IM_COL32_A_MASK)
+                    dst[x] = ImGui_ImplSoftRaster_BlendPixel(dst[x], ImGui_ImplSoftRaster_MulColors(src[x], prim.Col));
+        }
+        else
+        {
+            const float v = prim.V + prim.DvDy * (float)y;
+            for (int x = x0; x < x1; x++)
+            {
+                const ImU32 texel = ImGui_ImplSoftRaster_SampleBilinear(tex, prim.U + prim.DuDx * (float)x, v);
+                if (texel & IM_COL32_A_MASK)
+                    dst[x] = ImGui_ImplSoftRaster_BlendPixel(dst[x], ImGui_ImplSoftRaster_MulColors(texel, prim.Col));
+            }
+        }
+    }
+}
+
+static void ImGui_ImplSoftRaster_RasterizeTriangle(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_Prim& prim, int x0, int y0, int x1, int y1)
+{
+    const ImGui_ImplSoftRaster_Tri& tri = bd->Tris[prim.TriIndex];
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* dst = (ImU32*)(void*)((char*)bd->FbPixels + (size_t)y * (size_t)bd->FbStride);
+
+        // Solve the covered span [x, x_end) for this row: each edge function is linear in x, so every edge gives a lower or upper bound
+        ImS64 x = x0, x_end = x1;
+        for (int n = 0; n < 3 && x < x_end; n++)
+        {
+            const ImS64 e = tri.EdgeA[n] * x0 + tri.EdgeB[n] * y + tri.EdgeC[n];
+            const ImS64 a = tri.EdgeA[n];
+            if (a > 0 && e < 0)
+                x = ImGui_ImplSoftRaster_MaxS64(x, x0 + (-e + a - 1) / a);
+            else if (a < 0)
+                x_end = (e < 0) ? x : ImGui_ImplSoftRaster_MinS64(x_end, x0 + e / -a + 1);
+            else if (a == 0 && e < 0)
+                x_end = x;
+        }
+        if (x >= x_end)
+            continue;
+
+        if (!tri.HasGradient && !tri.HasUV)
+        {
+            ImGui_ImplSoftRaster_FillSpan(dst + x, (int)(x_end - x), tri.Col);
+            continue;
+        }
+        const float fy = (float)y;
+        for (; x < x_end; x++)
+        {
+            const float fx = (float)x;
+            ImU32 col = tri.Col;
+            if (tri.HasGradient)
+                col = ImGui_ImplSoftRaster_PackColor(
+                    tri.Attr[0][0] + tri.Attr[0][1] * fx + tri.Attr[0][2] * fy,
+                    tri.Attr[1][0] + tri.Attr[1][1] * fx + tri.Attr[1][2] * fy,
+                    tri.Attr[2][0] + tri.Attr[2][1] * fx + tri.Attr[2][2] * fy,
+                    tri.Attr[3][0] + tri.Attr[3][1] * fx + tri.Attr[3][2] * fy);
+            if (tri.HasUV)
+            {
+                const float u = tri.Attr[4][0] + tri.Attr[4][1] * fx + tri.Attr[4][2] * fy;
+                const float v = tri.Attr[5][0] + tri.Attr[5][1] * fx + tri.Attr[5][2] * fy;
+                col = ImGui_ImplSoftRaster_MulColors(ImGui_ImplSoftRaster_SampleBilinear(prim.Tex, u, v), col);
+            }
+            dst[x] = ImGui_ImplSoftRaster_BlendPixel(dst[x], col);
+        }
+    }
+}
+
+static void ImGui_ImplSoftRaster_RasterizeTile(ImGui_ImplSoftRaster_Data* bd, int tile_n)
+{
+    const int tile_x0 = (tile_n % bd->TilesCountX) << IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+    const int tile_y0 = (tile_n / bd->TilesCountX) << IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+    const int tile_x1 = ImGui_ImplSoftRaster_Min(tile_x0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, bd->FbWidth);
+    const int tile_y1 = ImGui_ImplSoftRaster_Min(tile_y0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, bd->FbHeight);
+    for (int bin_n = bd->TileBinStart[tile_n]; bin_n < bd->TileBinStart[tile_n + 1]; bin_n++)
+    {
+        const ImGui_ImplSoftRaster_Prim& prim = bd->Prims[bd->TileBins[bin_n]];
+        const int x0 = ImGui_ImplSoftRaster_Max(prim.MinX, tile_x0);
+        const int y0 = ImGui_ImplSoftRaster_Max(prim.MinY, tile_y0);
+        const int x1 = ImGui_ImplSoftRaster_Min(prim.MaxX, tile_x1);
+        const int y1 = ImGui_ImplSoftRaster_Min(prim.MaxY, tile_y1);
+        switch (prim.Type)
+        {
+        case ImGui_ImplSoftRaster_PrimType_QuadSolid:
+            for (int y = y0; y < y1; y++)
+                ImGui_ImplSoftRaster_FillSpan((ImU32*)(void*)((char*)bd->FbPixels + (size_t)y * (size_t)bd->FbStride) + x0, x1 - x0, prim.Col);
+            break;
+        case ImGui_ImplSoftRaster_PrimType_QuadTextured:
+            ImGui_ImplSoftRaster_RasterizeQuadTextured(bd, prim, x0, y0, x1, y1);
+            break;
+        case ImGui_ImplSoftRaster_PrimType_Triangle:
+            ImGui_ImplSoftRaster_RasterizeTriangle(bd, prim, x0, y0, x1, y1);
+            break;
+        }
+    }
+}
+
+#ifndef IMGUI_IMPL_SOFTRASTER_NO_THREADS
+static void ImGui_ImplSoftRaster_RasterizeActiveTiles(ImGui_ImplSoftRaster_Data* bd)
+{
+    for (int n = bd->NextActiveTile.fetch_add(1); n < bd->ActiveTiles.Size; n = bd->NextActiveTile.fetch_add(1))
+        ImGui_ImplSoftRaster_RasterizeTile(bd, bd->ActiveTiles[n]);
+}
+
+static void ImGui_ImplSoftRaster_WorkerThread(ImGui_ImplSoftRaster_Data* bd)
+{
+    int job_generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(bd->Mutex);
+            bd->JobCond.wait(lock, [&]() { return bd->WorkersQuit || bd->JobGeneration != job_generation; });
+            if (bd->WorkersQuit)
+                return;
+            job_generation = bd->JobGeneration;
+        }
+        ImGui_ImplSoftRaster_RasterizeActiveTiles(bd);
+        {
+            std::lock_guard<std::mutex> lock(bd->Mutex);
+            if (--bd->WorkersBusy == 0)
+                bd->DoneCond.notify_one();
+        }
+    }
+}
+#endif
+
+// Bin and rasterize all pending primitives
+static void ImGui_ImplSoftRaster_Flush(ImGui_ImplSoftRaster_Data* bd)
+{
+    if (bd->Prims.Size == 0)
+        return;
+
+    // Count primitives per tile, then fill bins in submission order
+    const int tiles_count = bd->TilesCountX * bd->TilesCountY;
+    bd->TileBinStart.resize(tiles_count + 1);
+    bd->TileBinCursor.resize(tiles_count);
+    memset(bd->TileBinStart.Data, 0, (size_t)bd->TileBinStart.size_in_bytes());
+    for (const ImGui_ImplSoftRaster_Prim& prim : bd->Prims)
+        for (int ty = prim.MinY >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT; ty <= (prim.MaxY - 1) >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT; ty++)
+            for (int tx = prim.MinX >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT; tx <= (prim.MaxX - 1) >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT; tx++)
+                bd->TileBinStart[ty * bd->TilesCountX + tx + 1]++;
+    bd->ActiveTiles.resize(0);
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+    {
+        if (bd->TileBinStart[tile_n + 1] > 0)
+            bd->ActiveTiles.push_back(tile_n);
+        bd->TileBinStart[tile_n + 1] += bd->TileBinStart[tile_n];
+        bd->TileBinCursor[tile_n] = bd->TileBinStart[tile_n];
+    }
+    bd->TileBins.resize(bd->TileBinStart[tiles_count]);
+    for (int prim_n = 0; prim_n < bd->Prims.Size; prim_n++)
+    {
+        const ImGui_ImplSoftRaster_Prim& prim = bd->Prims[prim_n];
+        for (int ty = prim.MinY >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT; ty <= (prim.MaxY - 1) >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT; ty++)
+            for (int tx = prim.MinX >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT; tx <= (prim.MaxX - 1) >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT; tx++)
+                bd->TileBins[bd->TileBinCursor[ty * bd->TilesCountX + tx]++] = prim_n;
+    }
+
+    // Rasterize tiles
+#ifndef IMGUI_IMPL_SOFTRASTER_NO_THREADS
+    if (bd->Workers.Size > 0 && bd->ActiveTiles.Size > 1)
+    {
+        bd->NextActiveTile = 0;
+        {
+            std::lock_guard<std::mutex> lock(bd->Mutex);
+            bd->JobGeneration++;
+            bd->WorkersBusy = bd->Workers.Size;
+        }
+        bd->JobCond.notify_all();
+        ImGui_ImplSoftRaster_RasterizeActiveTiles(bd);
+        std::unique_lock<std::mutex> lock(bd->Mutex);
+        bd->DoneCond.wait(lock, [&]() { return bd->WorkersBusy == 0; });
+    }
+    else
+#endif
+    {
+        for (int tile_n : bd->ActiveTiles)
+            ImGui_ImplSoftRaster_RasterizeTile(bd, tile_n);
+    }
+
+    bd->Prims.resize(0);
+    bd->Tris.resize(0);
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool ImGui_ImplSoftRaster_Init(int threads_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+    IM_ASSERT(threads_count >= 0);
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftRaster_Data* bd = IM_NEW(ImGui_ImplSoftRaster_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx; // We can decode the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT).
+
+    // Start worker threads (the thread calling ImGui_ImplSoftRaster_RenderDrawData() also rasterizes)
+#ifndef IMGUI_IMPL_SOFTRASTER_NO_THREADS
+    if (threads_count == 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    threads_count = ImGui_ImplSoftRaster_Max(1, ImGui_ImplSoftRaster_Min(threads_count, IMGUI_IMPL_SOFTRASTER_MAX_THREADS));
+    for (int n = 1; n < threads_count; n++)
+        bd->Workers.push_back(IM_NEW(std::thread)(ImGui_ImplSoftRaster_WorkerThread, bd));
+#else
+    threads_count = 1;
+#endif
+    bd->ThreadsCount = threads_count;
+
+    return true;
+}
+
+void ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+#ifndef IMGUI_IMPL_SOFTRASTER_NO_THREADS
+    {
+        std::lock_guard<std::mutex> lock(bd->Mutex);
+        bd->WorkersQuit = true;
+    }
+    bd->JobCond.notify_all();
+    for (std::thread* worker : bd->Workers)
+    {
+        worker->join();
+        IM_DELETE(worker);
+    }
+    bd->Workers.clear();
+#endif
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasCompactVtx);
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoftRaster_NewFrame()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplSoftRaster_Init()?");
+
+    if (!bd->FontTexture.Pixels && !ImGui::GetIO().Fonts->IsImmutable())
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+}
+
+void ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride)
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_ASSERT(pixels != nullptr && stride >= width * (int)sizeof(ImU32) && (stride % (int)sizeof(ImU32)) == 0);
+    if (width <= 0 || height <= 0)
+        return;
+
+    bd->FbPixels = pixels;
+    bd->FbWidth = width;
+    bd->FbHeight = height;
+    bd->FbStride = stride;
+    bd->TilesCountX = (width + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+    bd->TilesCountY = (height + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+    bd->Prims.resize(0);
+    bd->Tris.resize(0);
+
+    // Will project vertices and scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Convert command lists into primitives
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state: we have no state.)
+                // Rasterize everything submitted so far so the callback can read/write the framebuffer.
+                ImGui_ImplSoftRaster_Flush(bd);
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            const int clip_x0 = ImGui_ImplSoftRaster_Max((int)((pcmd->ClipRect.x - clip_off.x) * clip_scale.x), 0);
+            const int clip_y0 = ImGui_ImplSoftRaster_Max((int)((pcmd->ClipRect.y - clip_off.y) * clip_scale.y), 0);
+            const int clip_x1 = ImGui_ImplSoftRaster_Min((int)((pcmd->ClipRect.z - clip_off.x) * clip_scale.x), width);
+            const int clip_y1 = ImGui_ImplSoftRaster_Min((int)((pcmd->ClipRect.w - clip_off.y) * clip_scale.y), height);
+            if (clip_x1 <= clip_x0 || clip_y1 <= clip_y0)
+                continue;
+
+            const ImGui_ImplSoftRaster_Texture* tex = (const ImGui_ImplSoftRaster_Texture*)pcmd->GetTexID();
+            IM_ASSERT(tex != nullptr && tex->Pixels != nullptr && "ImTextureID needs to be a ImGui_ImplSoftRaster_Texture*");
+            const ImDrawVert* vtx = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            const ImDrawIdx* idx = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            for (unsigned int idx_n = 0; idx_n + 3 <= pcmd->ElemCount; )
+            {
+                if (idx_n + 6 <= pcmd->ElemCount && ImGui_ImplSoftRaster_AddQuad(bd, vtx, idx + idx_n, tex, clip_off, clip_scale, clip_x0, clip_y0, clip_x1, clip_y1))
+                {
+                    idx_n += 6;
+                    continue;
+                }
+                ImGui_ImplSoftRaster_AddTriangle(bd, &vtx[idx[idx_n]], &vtx[idx[idx_n + 1]], &vtx[idx[idx_n + 2]], tex, clip_off, clip_scale, clip_x0, clip_y0, clip_x1, clip_y1);
+                idx_n += 3;
+            }
+        }
+    }
+    ImGui_ImplSoftRaster_Flush(bd);
+    bd->FbPixels = nullptr;
+}
+
+bool ImGui_ImplSoftRaster_CreateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+
+    // A shared immutable atlas already has its texture set up by its owner: don't make a copy for each context
+    if (io.Fonts->IsImmutable())
+    {
+        IM_ASSERT(io.Fonts->TexID != 0 && "Set a ImGui_ImplSoftRaster_Texture* as TexID of the font atlas before calling SetImmutable()!");
+        return true;
+    }
+
+    // Build texture atlas
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    // Convert to IM_COL32() layout (which differs from RGBA bytes when IMGUI_USE_BGRA_PACKED_COLOR is defined)
+    bd->FontPixels.resize(width * height);
+    for (int n = 0; n < width * height; n++)
+        bd->FontPixels[n] = IM_COL32(pixels[n * 4 + 0], pixels[n * 4 + 1], pixels[n * 4 + 2], pixels[n * 4 + 3]);
+    bd->FontTexture.Pixels = bd->FontPixels.Data;
+    bd->FontTexture.Width = width;
+    bd->FontTexture.Height = height;
+
+    // Store our identifier
+    io.Fonts->SetTexID((ImTextureID)&bd->FontTexture);
+
+    return true;
+}
+
+void ImGui_ImplSoftRaster_DestroyFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    if (bd->FontTexture.Pixels)
+    {
+        if (!io.Fonts->IsImmutable())
+            io.Fonts->SetTexID(0);
+        bd->FontPixels.clear();
+        memset((void*)&bd->FontTexture, 0, sizeof(bd->FontTexture));
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
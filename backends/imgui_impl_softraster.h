@@ -0,0 +1,49 @@
+// dear imgui: Renderer Backend for a CPU software rasterizer
+// (No graphics API required: renders ImDrawData into a 32-bit framebuffer in system memory. Useful for headless servers, CI, thumbnails.)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded tile-based rasterization (see 'threads_count' parameter of ImGui_ImplSoftRaster_Init()).
+//  [X] Renderer: Compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+// Missing features:
+//  [ ] Renderer: No support for ImDrawCmdFlags_SDF (fonts baked with ImFontConfig::SDF).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#ifndef IMGUI_DISABLE
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// A texture which can be sampled by the software rasterizer. Pass a pointer to it as ImTextureID.
+// Pixels use the same layout as IM_COL32(), the storage is owned by you and needs to stay valid while rendering.
+// With a font atlas shared between contexts (ImFontAtlas::SetImmutable()), the backend doesn't create a font texture:
+// create one from the atlas pixels and pass it to SetTexID() before calling SetImmutable().
+struct ImGui_ImplSoftRaster_Texture
+{
+    const ImU32*    Pixels;
+    int             Width;
+    int             Height;
+};
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+// - threads_count: number of threads used to rasterize, including the calling thread. 0 = use std::thread::hardware_concurrency().
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(int threads_count = 0);
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+
+// Render into a framebuffer of 'width' x 'height' pixels using the IM_COL32() layout, 'stride' is the distance between rows in bytes.
+// The framebuffer is not cleared: draw your clear color/background before calling this.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride);
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyFontsTexture();
+
+#endif // #ifndef IMGUI_DISABLE
@@ -4,6 +4,8 @@
 // Implemented features:
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as ImTextureID. Read the FAQ about ImTextureID! See https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+//  [X] Renderer: Per draw list 32-bit indices for large meshes (ImGuiBackendFlags_RendererHasIdx32).
 
 // Important: on 32-bit systems, user texture binding is only supported if your imconfig file has '#define ImTextureID ImU64'.
 // This is because we need ImTextureID to carry a 64-bit value and by default ImTextureID is defined as void*.
@@ -33,6 +35,11 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: Vulkan: Don't call io.Fonts->SetTexID() when io.Fonts is a shared immutable atlas (see ImFontAtlas::SetImmutable()): its owner sets it.
+//  2026-10-18: Vulkan: Added support for draw lists promoted to 32-bit indices (ImDrawList::IdxBuffer32), set ImGuiBackendFlags_RendererHasIdx32.
+//  2026-10-18: Vulkan: Added support for the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT), set ImGuiBackendFlags_RendererHasCompactVtx.
+//  2026-10-18: Vulkan: Skip redundant vkCmdBindDescriptorSets()/vkCmdSetScissor() calls and merge consecutive draws sharing the same state. ImGui_ImplVulkan_AddTexture() creates and grows its own descriptor pools when ImGui_ImplVulkan_InitInfo::DescriptorPool is full or not set.
+//  2026-10-18: Vulkan: Vertices/indices are uploaded into a persistently mapped ring buffer shared by in-flight frames, growing geometrically, instead of mapping/unmapping per-frame buffers every frame. Added ImGui_ImplVulkan_InitInfo::UploadBufferSize and ImGui_ImplVulkan_GetRenderStats().
 //  2023-11-10: *BREAKING CHANGE*: Removed parameter from ImGui_ImplVulkan_CreateFontsTexture(): backend now creates its own command-buffer to upload fonts.
 //              *BREAKING CHANGE*: Removed ImGui_ImplVulkan_DestroyFontUploadObjects() which is now unecessary as we create and destroy those objects in the backend.
 //              ImGui_ImplVulkan_CreateFontsTexture() is automatically called by NewFrame() the first time.
@@ -85,15 +92,33 @@
 #endif
 
 // Reusable buffers used for rendering 1 current in-flight frame, for ImGui_ImplVulkan_RenderDrawData()
+// Vertices and indices are allocated from the upload ring buffer shared by all in-flight frames of a window.
 // [Please zero-clear before use!]
 struct ImGui_ImplVulkanH_FrameRenderBuffers
 {
-    VkDeviceMemory      VertexBufferMemory;
-    VkDeviceMemory      IndexBufferMemory;
-    VkDeviceSize        VertexBufferSize;
-    VkDeviceSize        IndexBufferSize;
-    VkBuffer            VertexBuffer;
-    VkBuffer            IndexBuffer;
+    VkBuffer            Buffer;                 // Upload ring buffer used by this frame
+    VkDeviceSize        VertexOffset;           // Offset of vertices in Buffer
+    VkDeviceSize        IndexOffset;            // Offset of indices in Buffer
+    VkDeviceSize        Index32Offset;          // Offset of 32-bit indices of draw lists promoted by ImGuiBackendFlags_RendererHasIdx32 in Buffer
+    VkDeviceSize        RingAllocatedSize;      // Bytes allocated from the ring for this frame (including padding skipped when wrapping around), released when this frame is reused
+    uint32_t            RingGeneration;         // Generation of the ring buffer those bytes were allocated from
+    VkBuffer            RetiredBuffer;          // Ring buffer replaced by a larger one while recording this frame. Destroyed when this frame is reused, as all frames using it have completed.
+    VkDeviceMemory      RetiredBufferMemory;
+};
+
+// Persistently mapped buffer from which all in-flight frames allocate their vertices and indices.
+// Allocations are made in frame order and released in the same order when a frame is reused, so the free space is always [Head, Head - Used) modulo Size.
+// [Please zero-clear before use!]
+struct ImGui_ImplVulkanH_UploadRingBuffer
+{
+    VkBuffer            Buffer;
+    VkDeviceMemory      BufferMemory;
+    VkDeviceSize        Size;
+    VkDeviceSize        Head;                   // Offset of next allocation
+    VkDeviceSize        Used;                   // Bytes allocated by in-flight frames
+    void*               MappedData;             // Mapped for the lifetime of the buffer
+    bool                NeedFlush;              // Memory is not HOST_COHERENT: call vkFlushMappedMemoryRanges() after writing
+    uint32_t            Generation;             // Incremented every time the buffer is replaced
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -103,6 +128,22 @@ struct ImGui_ImplVulkanH_WindowRenderBuffers
     uint32_t            Index;
     uint32_t            Count;
     ImGui_ImplVulkanH_FrameRenderBuffers*   FrameRenderBuffers;
+    ImGui_ImplVulkanH_UploadRingBuffer      UploadRingBuffer;
+};
+
+// Descriptor pool created by the backend when ImGui_ImplVulkan_InitInfo::DescriptorPool is not set or is full
+struct ImGui_ImplVulkan_DescriptorPool
+{
+    VkDescriptorPool            Pool;
+    uint32_t                    Capacity;
+    uint32_t                    Used;
+};
+
+// Descriptor set allocated from one of our own descriptor pools (needed to free it from the right pool)
+struct ImGui_ImplVulkan_DescriptorSetAlloc
+{
+    VkDescriptorSet             Set;
+    int                         PoolIndex;
 };
 
 // Vulkan data
@@ -110,7 +151,6 @@ struct ImGui_ImplVulkan_Data
 {
     ImGui_ImplVulkan_InitInfo   VulkanInitInfo;
     VkRenderPass                RenderPass;
-    VkDeviceSize                BufferMemoryAlignment;
     VkPipelineCreateFlags       PipelineCreateFlags;
     VkDescriptorSetLayout       DescriptorSetLayout;
     VkPipelineLayout            PipelineLayout;
@@ -131,10 +171,16 @@ struct ImGui_ImplVulkan_Data
     // Render buffers for main window
     ImGui_ImplVulkanH_WindowRenderBuffers MainWindowRenderBuffers;
 
+    // Growable descriptor pools used by ImGui_ImplVulkan_AddTexture()
+    ImVector<ImGui_ImplVulkan_DescriptorPool>       DescriptorPools;
+    ImVector<ImGui_ImplVulkan_DescriptorSetAlloc>   DescriptorPoolSets;
+
+    // Statistics for last call to ImGui_ImplVulkan_RenderDrawData()
+    ImGui_ImplVulkan_RenderStats RenderStats;
+
     ImGui_ImplVulkan_Data()
     {
         memset((void*)this, 0, sizeof(*this));
-        BufferMemoryAlignment = 256;
     }
 };
 
@@ -175,6 +221,7 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdSetViewport) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateBuffer) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateCommandPool) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateDescriptorPool) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateDescriptorSetLayout) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateFence) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateFramebuffer) \
@@ -189,6 +236,7 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCreateSwapchainKHR) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyBuffer) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyCommandPool) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyDescriptorPool) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyDescriptorSetLayout) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyFence) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkDestroyFramebuffer) \
@@ -377,38 +425,115 @@ static void check_vk_result(VkResult err)
         v->CheckVkResultFn(err);
 }
 
-static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory, VkDeviceSize& p_buffer_size, size_t new_size, VkBufferUsageFlagBits usage)
+// Upload ring buffer default size (grows as needed, see ImGui_ImplVulkan_InitInfo::UploadBufferSize)
+#define IMGUI_IMPL_VULKAN_UPLOAD_BUFFER_DEFAULT_SIZE    (256 * 1024)
+#define IMGUI_IMPL_VULKAN_UPLOAD_BUFFER_ALIGNMENT       16
+#define IMGUI_IMPL_VULKAN_DESCRIPTOR_POOL_MIN_SETS      256     // Capacity of the first descriptor pool created by the backend, next ones double in size
+
+static void CreateUploadRingBuffer(ImGui_ImplVulkanH_UploadRingBuffer* ring, VkDeviceSize size)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
     VkResult err;
-    if (buffer != VK_NULL_HANDLE)
-        vkDestroyBuffer(v->Device, buffer, v->Allocator);
-    if (buffer_memory != VK_NULL_HANDLE)
-        vkFreeMemory(v->Device, buffer_memory, v->Allocator);
 
-    VkDeviceSize vertex_buffer_size_aligned = ((new_size - 1) / bd->BufferMemoryAlignment + 1) * bd->BufferMemoryAlignment;
     VkBufferCreateInfo buffer_info = {};
     buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    buffer_info.size = vertex_buffer_size_aligned;
-    buffer_info.usage = usage;
+    buffer_info.size = size;
+    buffer_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
     buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &buffer);
+    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &ring->Buffer);
     check_vk_result(err);
 
+    // Prefer HOST_COHERENT memory so we never need to flush (the specs guarantee a HOST_VISIBLE|HOST_COHERENT memory type is available for buffers)
     VkMemoryRequirements req;
-    vkGetBufferMemoryRequirements(v->Device, buffer, &req);
-    bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
+    vkGetBufferMemoryRequirements(v->Device, ring->Buffer, &req);
     VkMemoryAllocateInfo alloc_info = {};
     alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     alloc_info.allocationSize = req.size;
-    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
-    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &buffer_memory);
+    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+    ring->NeedFlush = (alloc_info.memoryTypeIndex == 0xFFFFFFFF);
+    if (ring->NeedFlush)
+        alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
+    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &ring->BufferMemory);
+    check_vk_result(err);
+    err = vkBindBufferMemory(v->Device, ring->Buffer, ring->BufferMemory, 0);
     check_vk_result(err);
 
-    err = vkBindBufferMemory(v->Device, buffer, buffer_memory, 0);
+    // Map once for the lifetime of the buffer
+    err = vkMapMemory(v->Device, ring->BufferMemory, 0, VK_WHOLE_SIZE, 0, &ring->MappedData);
     check_vk_result(err);
-    p_buffer_size = req.size;
+    ring->Size = size;
+    ring->Head = 0;
+    ring->Used = 0;
+    ring->Generation++;
+}
+
+static void DestroyUploadBuffer(VkDevice device, VkBuffer& buffer, VkDeviceMemory& buffer_memory, const VkAllocationCallbacks* allocator)
+{
+    if (buffer_memory != VK_NULL_HANDLE) { vkUnmapMemory(device, buffer_memory); }
+    if (buffer != VK_NULL_HANDLE) { vkDestroyBuffer(device, buffer, allocator); buffer = VK_NULL_HANDLE; }
+    if (buffer_memory != VK_NULL_HANDLE) { vkFreeMemory(device, buffer_memory, allocator); buffer_memory = VK_NULL_HANDLE; }
+}
+
+// Allocate 'size' bytes for the current frame 'rb' from the upload ring buffer. Returns offset in the buffer.
+// When there isn't enough contiguous free space, the buffer is replaced by a larger one (geometric growth).
+// The previous buffer may still be read by in-flight frames so it is retired into 'rb' and destroyed when 'rb' is reused.
+static VkDeviceSize AllocateFromUploadRingBuffer(ImGui_ImplVulkanH_WindowRenderBuffers* wrb, ImGui_ImplVulkanH_FrameRenderBuffers* rb, VkDeviceSize size)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkanH_UploadRingBuffer* ring = &wrb->UploadRingBuffer;
+    size = (size + IMGUI_IMPL_VULKAN_UPLOAD_BUFFER_ALIGNMENT - 1) & ~(VkDeviceSize)(IMGUI_IMPL_VULKAN_UPLOAD_BUFFER_ALIGNMENT - 1);
+
+    VkDeviceSize padding = 0;
+    bool fits = false;
+    if (ring->Buffer != VK_NULL_HANDLE)
+    {
+        if (ring->Used == 0)
+            ring->Head = 0;
+        const VkDeviceSize tail = (ring->Head + ring->Size - ring->Used) % ring->Size;
+        if (ring->Used < ring->Size && ring->Head >= tail)
+        {
+            // Free space is [Head, Size) + [0, tail)
+            if (ring->Head + size <= ring->Size)
+                fits = true;
+            else if (size <= tail)
+            {
+                padding = ring->Size - ring->Head;
+                fits = true;
+            }
+        }
+        else if (ring->Head + size <= tail)
+        {
+            // Free space is [Head, tail)
+            fits = true;
+        }
+    }
+
+    if (!fits)
+    {
+        // Grow: leave room for all in-flight frames to use as much as this one
+        VkDeviceSize new_size = ring->Size ? ring->Size * 2 : (bd->VulkanInitInfo.UploadBufferSize ? bd->VulkanInitInfo.UploadBufferSize : IMGUI_IMPL_VULKAN_UPLOAD_BUFFER_DEFAULT_SIZE);
+        while (new_size < size * wrb->Count)
+            new_size *= 2;
+        if (ring->Buffer != VK_NULL_HANDLE)
+        {
+            IM_ASSERT(rb->RetiredBuffer == VK_NULL_HANDLE); // Only one allocation per frame
+            rb->RetiredBuffer = ring->Buffer;
+            rb->RetiredBufferMemory = ring->BufferMemory;
+            ring->Buffer = VK_NULL_HANDLE;
+            ring->BufferMemory = VK_NULL_HANDLE;
+            bd->RenderStats.UploadBufferGrowCount++;
+        }
+        CreateUploadRingBuffer(ring, new_size);
+        padding = 0;
+    }
+
+    const VkDeviceSize offset = (padding > 0) ? 0 : ring->Head;
+    ring->Head = offset + size;
+    ring->Used += padding + size;
+    rb->RingAllocatedSize += padding + size;
+    rb->RingGeneration = ring->Generation;
+    return offset;
 }
 
 static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkanH_FrameRenderBuffers* rb, int fb_width, int fb_height)
@@ -423,10 +548,10 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
     // Bind Vertex And Index Buffer:
     if (draw_data->TotalVtxCount > 0)
     {
-        VkBuffer vertex_buffers[1] = { rb->VertexBuffer };
-        VkDeviceSize vertex_offset[1] = { 0 };
+        VkBuffer vertex_buffers[1] = { rb->Buffer };
+        VkDeviceSize vertex_offset[1] = { rb->VertexOffset };
         vkCmdBindVertexBuffers(command_buffer, 0, 1, vertex_buffers, vertex_offset);
-        vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(command_buffer, rb->Buffer, rb->IndexOffset, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
     }
 
     // Setup viewport:
@@ -450,6 +575,11 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
         float translate[2];
         translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
         translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Positions are fixed-point (R16G16_SSCALED), fold the decoding into the scale
+        scale[0] /= (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS);
+        scale[1] /= (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS);
+#endif
         vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
         vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
     }
@@ -482,43 +612,68 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     wrb->Index = (wrb->Index + 1) % wrb->Count;
     ImGui_ImplVulkanH_FrameRenderBuffers* rb = &wrb->FrameRenderBuffers[wrb->Index];
 
+    // Previous use of this frame has completed: release its allocation from the upload ring buffer and destroy the ring buffer retired while recording it
+    ImGui_ImplVulkanH_UploadRingBuffer* ring = &wrb->UploadRingBuffer;
+    if (rb->RingGeneration == ring->Generation)
+        ring->Used -= rb->RingAllocatedSize;
+    rb->RingAllocatedSize = 0;
+    DestroyUploadBuffer(v->Device, rb->RetiredBuffer, rb->RetiredBufferMemory, v->Allocator);
+
+    ImGui_ImplVulkan_RenderStats* stats = &bd->RenderStats;
+    const uint32_t grow_count_before = stats->UploadBufferGrowCount;
+    stats->UploadBytes = 0;
     if (draw_data->TotalVtxCount > 0)
     {
-        // Create or resize the vertex/index buffers
-        size_t vertex_size = draw_data->TotalVtxCount * sizeof(ImDrawVert);
-        size_t index_size = draw_data->TotalIdxCount * sizeof(ImDrawIdx);
-        if (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < vertex_size)
-            CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-        if (rb->IndexBuffer == VK_NULL_HANDLE || rb->IndexBufferSize < index_size)
-            CreateOrResizeBuffer(rb->IndexBuffer, rb->IndexBufferMemory, rb->IndexBufferSize, index_size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
-
-        // Upload vertex/index data into a single contiguous GPU buffer
-        ImDrawVert* vtx_dst = nullptr;
-        ImDrawIdx* idx_dst = nullptr;
-        VkResult err = vkMapMemory(v->Device, rb->VertexBufferMemory, 0, rb->VertexBufferSize, 0, (void**)(&vtx_dst));
-        check_vk_result(err);
-        err = vkMapMemory(v->Device, rb->IndexBufferMemory, 0, rb->IndexBufferSize, 0, (void**)(&idx_dst));
-        check_vk_result(err);
+        // Allocate vertices and indices for this frame from the persistently mapped upload ring buffer
+        const VkDeviceSize vertex_size = (VkDeviceSize)draw_data->TotalVtxCount * sizeof(ImDrawVert);
+        const VkDeviceSize vertex_size_aligned = (vertex_size + IMGUI_IMPL_VULKAN_UPLOAD_BUFFER_ALIGNMENT - 1) & ~(VkDeviceSize)(IMGUI_IMPL_VULKAN_UPLOAD_BUFFER_ALIGNMENT - 1);
+        // Indices of draw lists promoted to 32-bit (see ImGuiBackendFlags_RendererHasIdx32) are stored in a second region following the ImDrawIdx ones.
+        int idx32_count = 0;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            if (draw_data->CmdLists[n]->GetIdxSize() != sizeof(ImDrawIdx))
+                idx32_count += draw_data->CmdLists[n]->GetIdxCount();
+        const VkDeviceSize index_size = (VkDeviceSize)(draw_data->TotalIdxCount - idx32_count) * sizeof(ImDrawIdx);
+        const VkDeviceSize index_size_aligned = (index_size + 3) & ~(VkDeviceSize)3;
+        const VkDeviceSize index32_size = (VkDeviceSize)idx32_count * sizeof(ImU32);
+        rb->VertexOffset = AllocateFromUploadRingBuffer(wrb, rb, vertex_size_aligned + index_size_aligned + index32_size);
+        rb->IndexOffset = rb->VertexOffset + vertex_size_aligned;
+        rb->Index32Offset = rb->IndexOffset + index_size_aligned;
+        rb->Buffer = ring->Buffer;
+
+        // Upload vertex/index data
+        ImDrawVert* vtx_dst = (ImDrawVert*)(void*)((char*)ring->MappedData + rb->VertexOffset);
+        ImDrawIdx* idx_dst = (ImDrawIdx*)(void*)((char*)ring->MappedData + rb->IndexOffset);
+        ImU32* idx32_dst = (ImU32*)(void*)((char*)ring->MappedData + rb->Index32Offset);
         for (int n = 0; n < draw_data->CmdListsCount; n++)
         {
             const ImDrawList* cmd_list = draw_data->CmdLists[n];
             memcpy(vtx_dst, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
-            memcpy(idx_dst, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
             vtx_dst += cmd_list->VtxBuffer.Size;
-            idx_dst += cmd_list->IdxBuffer.Size;
+            if (cmd_list->GetIdxSize() != sizeof(ImDrawIdx))
+            {
+                memcpy(idx32_dst, cmd_list->GetIdxData(), cmd_list->GetIdxCount() * sizeof(ImU32));
+                idx32_dst += cmd_list->GetIdxCount();
+            }
+            else
+            {
+                memcpy(idx_dst, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+                idx_dst += cmd_list->IdxBuffer.Size;
+            }
         }
-        VkMappedMemoryRange range[2] = {};
-        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[0].memory = rb->VertexBufferMemory;
-        range[0].size = VK_WHOLE_SIZE;
-        range[1].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[1].memory = rb->IndexBufferMemory;
-        range[1].size = VK_WHOLE_SIZE;
-        err = vkFlushMappedMemoryRanges(v->Device, 2, range);
-        check_vk_result(err);
-        vkUnmapMemory(v->Device, rb->VertexBufferMemory);
-        vkUnmapMemory(v->Device, rb->IndexBufferMemory);
+        if (ring->NeedFlush)
+        {
+            VkMappedMemoryRange range = {};
+            range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range.memory = ring->BufferMemory;
+            range.size = VK_WHOLE_SIZE;
+            VkResult err = vkFlushMappedMemoryRanges(v->Device, 1, &range);
+            check_vk_result(err);
+        }
+        stats->UploadBytes = vertex_size + index_size + index32_size;
     }
+    stats->UploadBufferSize = ring->Size;
+    stats->UploadBufferUsed = ring->Used;
+    stats->UploadBufferGrewThisFrame = (stats->UploadBufferGrowCount != grow_count_before);
 
     // Setup desired Vulkan state
     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
@@ -529,20 +684,58 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
 
     // Render command lists
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
+    // We keep track of the bound descriptor set and scissor to avoid redundant state changes, and merge consecutive
+    // commands sharing the same state and contiguous indices into a single draw call.
+    // Draw lists promoted to 32-bit indices are drawn from their own region, rebinding the index buffer when switching between regions.
+    stats->DrawCmdCount = stats->DrawCallCount = stats->DescriptorSetBindCount = stats->ScissorSetCount = 0;
+    VkDescriptorSet last_desc_set = VK_NULL_HANDLE;
+    VkRect2D last_scissor = { { -1, -1 }, { 0, 0 } };
+    uint32_t draw_idx_offset = 0;
+    uint32_t draw_idx_count = 0;
+    int32_t draw_vtx_offset = 0;
     int global_vtx_offset = 0;
     int global_idx_offset = 0;
+    int global_idx32_offset = 0;
+    bool idx32_bound = false;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        const bool idx32 = (cmd_list->GetIdxSize() != sizeof(ImDrawIdx));
+        if (idx32 != idx32_bound && cmd_list->CmdBuffer.Size > 0)
+        {
+            if (draw_idx_count > 0)
+            {
+                vkCmdDrawIndexed(command_buffer, draw_idx_count, 1, draw_idx_offset, draw_vtx_offset, 0);
+                stats->DrawCallCount++;
+                draw_idx_count = 0;
+            }
+            vkCmdBindIndexBuffer(command_buffer, rb->Buffer, idx32 ? rb->Index32Offset : rb->IndexOffset, (idx32 || sizeof(ImDrawIdx) == 4) ? VK_INDEX_TYPE_UINT32 : VK_INDEX_TYPE_UINT16);
+            idx32_bound = idx32;
+        }
+        const int list_idx_offset = idx32 ? global_idx32_offset : global_idx_offset;
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
             if (pcmd->UserCallback != nullptr)
             {
+                // Submit pending draw before the callback, and forget about bound state as the callback may change it
+                if (draw_idx_count > 0)
+                {
+                    vkCmdDrawIndexed(command_buffer, draw_idx_count, 1, draw_idx_offset, draw_vtx_offset, 0);
+                    stats->DrawCallCount++;
+                    draw_idx_count = 0;
+                }
+                last_desc_set = VK_NULL_HANDLE;
+                last_scissor.offset.x = last_scissor.offset.y = -1;
+
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
+                    if (idx32_bound)
+                        vkCmdBindIndexBuffer(command_buffer, rb->Buffer, rb->Index32Offset, VK_INDEX_TYPE_UINT32);
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -560,15 +753,14 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
-                // Apply scissor/clipping rectangle
                 VkRect2D scissor;
                 scissor.offset.x = (int32_t)(clip_min.x);
                 scissor.offset.y = (int32_t)(clip_min.y);
                 scissor.extent.width = (uint32_t)(clip_max.x - clip_min.x);
                 scissor.extent.height = (uint32_t)(clip_max.y - clip_min.y);
-                vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+                const bool scissor_changed = (scissor.offset.x != last_scissor.offset.x || scissor.offset.y != last_scissor.offset.y || scissor.extent.width != last_scissor.extent.width || scissor.extent.height != last_scissor.extent.height);
 
-                // Bind DescriptorSet with font or user texture
+                // Font or user texture
                 VkDescriptorSet desc_set[1] = { (VkDescriptorSet)pcmd->TextureId };
                 if (sizeof(ImTextureID) < sizeof(ImU64))
                 {
@@ -576,15 +768,56 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                     IM_ASSERT(pcmd->TextureId == (ImTextureID)bd->FontDescriptorSet);
                     desc_set[0] = bd->FontDescriptorSet;
                 }
-                vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, desc_set, 0, nullptr);
+                const bool desc_set_changed = (desc_set[0] != last_desc_set);
 
-                // Draw
-                vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
+                // Extend pending draw if state is unchanged and indices are contiguous, otherwise submit it
+                stats->DrawCmdCount++;
+                const uint32_t idx_offset = pcmd->IdxOffset + list_idx_offset;
+                const int32_t vtx_offset = (int32_t)(pcmd->VtxOffset + global_vtx_offset);
+                if (draw_idx_count > 0 && !scissor_changed && !desc_set_changed && idx_offset == draw_idx_offset + draw_idx_count && vtx_offset == draw_vtx_offset)
+                {
+                    draw_idx_count += pcmd->ElemCount;
+                    continue;
+                }
+                if (draw_idx_count > 0)
+                {
+                    vkCmdDrawIndexed(command_buffer, draw_idx_count, 1, draw_idx_offset, draw_vtx_offset, 0);
+                    stats->DrawCallCount++;
+                }
+
+                // Apply scissor/clipping rectangle
+                if (scissor_changed)
+                {
+                    vkCmdSetScissor(command_buffer, 0, 1, &scissor);
+                    stats->ScissorSetCount++;
+                    last_scissor = scissor;
+                }
+
+                // Bind DescriptorSet with font or user texture
+                if (desc_set_changed)
+                {
+                    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, desc_set, 0, nullptr);
+                    stats->DescriptorSetBindCount++;
+                    last_desc_set = desc_set[0];
+                }
+
+                // Draw (deferred)
+                draw_idx_offset = idx_offset;
+                draw_idx_count = pcmd->ElemCount;
+                draw_vtx_offset = vtx_offset;
             }
         }
-        global_idx_offset += cmd_list->IdxBuffer.Size;
+        if (idx32)
+            global_idx32_offset += cmd_list->GetIdxCount();
+        else
+            global_idx_offset += cmd_list->GetIdxCount();
         global_vtx_offset += cmd_list->VtxBuffer.Size;
     }
+    if (draw_idx_count > 0)
+    {
+        vkCmdDrawIndexed(command_buffer, draw_idx_count, 1, draw_idx_offset, draw_vtx_offset, 0);
+        stats->DrawCallCount++;
+    }
 
     // Note: at this point both vkCmdSetViewport() and vkCmdSetScissor() have been called.
     // Our last values will leak into user/application rendering IF:
@@ -706,7 +939,6 @@ bool ImGui_ImplVulkan_CreateFontsTexture()
         check_vk_result(err);
         VkMemoryRequirements req;
         vkGetBufferMemoryRequirements(v->Device, upload_buffer, &req);
-        bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
         VkMemoryAllocateInfo alloc_info = {};
         alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
         alloc_info.allocationSize = req.size;
@@ -770,8 +1002,9 @@ bool ImGui_ImplVulkan_CreateFontsTexture()
         vkCmdPipelineBarrier(bd->FontCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, use_barrier);
     }
 
-    // Store our identifier
-    io.Fonts->SetTexID((ImTextureID)bd->FontDescriptorSet);
+    // Store our identifier (unless the atlas is immutable: it is shared and its owner sets it)
+    if (!io.Fonts->IsImmutable())
+        io.Fonts->SetTexID((ImTextureID)bd->FontDescriptorSet);
 
     // End command buffer
     VkSubmitInfo end_info = {};
@@ -803,7 +1036,8 @@ void ImGui_ImplVulkan_DestroyFontsTexture()
     {
         ImGui_ImplVulkan_RemoveTexture(bd->FontDescriptorSet);
         bd->FontDescriptorSet = VK_NULL_HANDLE;
-        io.Fonts->SetTexID(0);
+        if (!io.Fonts->IsImmutable())
+            io.Fonts->SetTexID(0);
     }
 
     if (bd->FontView)   { vkDestroyImageView(v->Device, bd->FontView, v->Allocator); bd->FontView = VK_NULL_HANDLE; }
@@ -857,11 +1091,19 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     VkVertexInputAttributeDescription attribute_desc[3] = {};
     attribute_desc[0].location = 0;
     attribute_desc[0].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[0].format = VK_FORMAT_R16G16_SSCALED;
+#else
     attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[0].offset = offsetof(ImDrawVert, pos);
     attribute_desc[1].location = 1;
     attribute_desc[1].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[1].format = VK_FORMAT_R16G16_UNORM;
+#else
     attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[1].offset = offsetof(ImDrawVert, uv);
     attribute_desc[2].location = 2;
     attribute_desc[2].binding = binding_desc[0].binding;
@@ -1020,6 +1262,12 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
     ImGui_ImplVulkanH_DestroyWindowRenderBuffers(v->Device, &bd->MainWindowRenderBuffers, v->Allocator);
     ImGui_ImplVulkan_DestroyFontsTexture();
 
+    // Destroying our descriptor pools implicitly frees descriptor sets allocated from them
+    for (ImGui_ImplVulkan_DescriptorPool& pool : bd->DescriptorPools)
+        vkDestroyDescriptorPool(v->Device, pool.Pool, v->Allocator);
+    bd->DescriptorPools.clear();
+    bd->DescriptorPoolSets.clear();
+
     if (bd->FontCommandPool)      { vkDestroyCommandPool(v->Device, bd->FontCommandPool, v->Allocator); bd->FontCommandPool = VK_NULL_HANDLE; }
     if (bd->ShaderModuleVert)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleVert, v->Allocator); bd->ShaderModuleVert = VK_NULL_HANDLE; }
     if (bd->ShaderModuleFrag)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleFrag, v->Allocator); bd->ShaderModuleFrag = VK_NULL_HANDLE; }
@@ -1083,12 +1331,13 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info, VkRenderPass rend
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasCompactVtx; // We can decode the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT).
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdx32;      // We can render draw lists promoted to 32-bit indices (ImDrawList::IdxBuffer32).
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
     IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
     IM_ASSERT(info->Device != VK_NULL_HANDLE);
     IM_ASSERT(info->Queue != VK_NULL_HANDLE);
-    IM_ASSERT(info->DescriptorPool != VK_NULL_HANDLE);
     IM_ASSERT(info->MinImageCount >= 2);
     IM_ASSERT(info->ImageCount >= info->MinImageCount);
     if (info->UseDynamicRendering == false)
@@ -1112,7 +1361,7 @@ void ImGui_ImplVulkan_Shutdown()
     ImGui_ImplVulkan_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasCompactVtx | ImGuiBackendFlags_RendererHasIdx32);
     IM_DELETE(bd);
 }
 
@@ -1139,6 +1388,28 @@ void ImGui_ImplVulkan_SetMinImageCount(uint32_t min_image_count)
     bd->VulkanInitInfo.MinImageCount = min_image_count;
 }
 
+void ImGui_ImplVulkan_GetRenderStats(ImGui_ImplVulkan_RenderStats* out_stats)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplVulkan_Init()?");
+    *out_stats = bd->RenderStats;
+}
+
+// Failure from vkAllocateDescriptorSets() meaning the pool has no room left (other errors are reported, not treated as a full pool)
+static bool ImGui_ImplVulkan_IsDescriptorPoolFull(VkResult err)
+{
+    if (err == VK_ERROR_FRAGMENTED_POOL)
+        return true;
+#if defined(VK_VERSION_1_1)
+    if (err == VK_ERROR_OUT_OF_POOL_MEMORY)
+        return true;
+#elif defined(VK_KHR_maintenance1)
+    if (err == VK_ERROR_OUT_OF_POOL_MEMORY_KHR)
+        return true;
+#endif
+    return false;
+}
+
 // Register a texture
 // FIXME: This is experimental in the sense that we are unsure how to best design/tackle this problem, please post to https://github.com/ocornut/imgui/pull/914 if you have suggestions.
 VkDescriptorSet ImGui_ImplVulkan_AddTexture(VkSampler sampler, VkImageView image_view, VkImageLayout image_layout)
@@ -1147,15 +1418,61 @@ VkDescriptorSet ImGui_ImplVulkan_AddTexture(VkSampler sampler, VkImageView image
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
 
     // Create Descriptor Set:
-    VkDescriptorSet descriptor_set;
+    // - First try the pool provided in ImGui_ImplVulkan_InitInfo, if any.
+    // - Once it is full (or if none was provided), allocate from our own pools, creating a larger one when all of them are full.
+    // - Any other allocation error is passed to CheckVkResultFn.
+    VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.pSetLayouts = &bd->DescriptorSetLayout;
+    if (v->DescriptorPool != VK_NULL_HANDLE)
     {
-        VkDescriptorSetAllocateInfo alloc_info = {};
-        alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
         alloc_info.descriptorPool = v->DescriptorPool;
-        alloc_info.descriptorSetCount = 1;
-        alloc_info.pSetLayouts = &bd->DescriptorSetLayout;
         VkResult err = vkAllocateDescriptorSets(v->Device, &alloc_info, &descriptor_set);
-        check_vk_result(err);
+        if (err != VK_SUCCESS)
+        {
+            if (!ImGui_ImplVulkan_IsDescriptorPoolFull(err))
+                check_vk_result(err);
+            descriptor_set = VK_NULL_HANDLE;
+        }
+    }
+    if (descriptor_set == VK_NULL_HANDLE)
+    {
+        int pool_index = -1;
+        for (int n = bd->DescriptorPools.Size - 1; n >= 0 && pool_index == -1; n--)
+            if (bd->DescriptorPools[n].Used < bd->DescriptorPools[n].Capacity)
+            {
+                alloc_info.descriptorPool = bd->DescriptorPools[n].Pool;
+                VkResult err = vkAllocateDescriptorSets(v->Device, &alloc_info, &descriptor_set);
+                if (err == VK_SUCCESS)
+                    pool_index = n;
+                else if (!ImGui_ImplVulkan_IsDescriptorPoolFull(err))
+                    check_vk_result(err);
+            }
+        if (pool_index == -1)
+        {
+            ImGui_ImplVulkan_DescriptorPool pool;
+            pool.Capacity = bd->DescriptorPools.Size > 0 ? bd->DescriptorPools.back().Capacity * 2 : IMGUI_IMPL_VULKAN_DESCRIPTOR_POOL_MIN_SETS;
+            pool.Used = 0;
+            VkDescriptorPoolSize pool_size = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, pool.Capacity };
+            VkDescriptorPoolCreateInfo pool_info = {};
+            pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+            pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+            pool_info.maxSets = pool.Capacity;
+            pool_info.poolSizeCount = 1;
+            pool_info.pPoolSizes = &pool_size;
+            VkResult err = vkCreateDescriptorPool(v->Device, &pool_info, v->Allocator, &pool.Pool);
+            check_vk_result(err);
+            bd->DescriptorPools.push_back(pool);
+            pool_index = bd->DescriptorPools.Size - 1;
+            alloc_info.descriptorPool = pool.Pool;
+            err = vkAllocateDescriptorSets(v->Device, &alloc_info, &descriptor_set);
+            check_vk_result(err);
+        }
+        bd->DescriptorPools[pool_index].Used++;
+        ImGui_ImplVulkan_DescriptorSetAlloc set_alloc = { descriptor_set, pool_index };
+        bd->DescriptorPoolSets.push_back(set_alloc);
     }
 
     // Update the Descriptor Set:
@@ -1179,6 +1496,16 @@ void ImGui_ImplVulkan_RemoveTexture(VkDescriptorSet descriptor_set)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    for (int n = 0; n < bd->DescriptorPoolSets.Size; n++)
+        if (bd->DescriptorPoolSets[n].Set == descriptor_set)
+        {
+            ImGui_ImplVulkan_DescriptorPool* pool = &bd->DescriptorPools[bd->DescriptorPoolSets[n].PoolIndex];
+            vkFreeDescriptorSets(v->Device, pool->Pool, 1, &descriptor_set);
+            pool->Used--;
+            bd->DescriptorPoolSets.erase_unsorted(&bd->DescriptorPoolSets[n]);
+            return;
+        }
+    IM_ASSERT(v->DescriptorPool != VK_NULL_HANDLE);
     vkFreeDescriptorSets(v->Device, v->DescriptorPool, 1, &descriptor_set);
 }
 
@@ -1548,12 +1875,9 @@ void ImGui_ImplVulkanH_DestroyFrameSemaphores(VkDevice device, ImGui_ImplVulkanH
 
 void ImGui_ImplVulkanH_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulkanH_FrameRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
 {
-    if (buffers->VertexBuffer) { vkDestroyBuffer(device, buffers->VertexBuffer, allocator); buffers->VertexBuffer = VK_NULL_HANDLE; }
-    if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
-    if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
-    if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
-    buffers->VertexBufferSize = 0;
-    buffers->IndexBufferSize = 0;
+    DestroyUploadBuffer(device, buffers->RetiredBuffer, buffers->RetiredBufferMemory, allocator);
+    buffers->Buffer = VK_NULL_HANDLE;
+    buffers->RingAllocatedSize = 0;
 }
 
 void ImGui_ImplVulkanH_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkanH_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
@@ -1561,6 +1885,8 @@ void ImGui_ImplVulkanH_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVul
     for (uint32_t n = 0; n < buffers->Count; n++)
         ImGui_ImplVulkanH_DestroyFrameRenderBuffers(device, &buffers->FrameRenderBuffers[n], allocator);
     IM_FREE(buffers->FrameRenderBuffers);
+    DestroyUploadBuffer(device, buffers->UploadRingBuffer.Buffer, buffers->UploadRingBuffer.BufferMemory, allocator);
+    memset((void*)&buffers->UploadRingBuffer, 0, sizeof(buffers->UploadRingBuffer));
     buffers->FrameRenderBuffers = nullptr;
     buffers->Index = 0;
     buffers->Count = 0;
@@ -4,6 +4,8 @@
 // Implemented features:
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as ImTextureID. Read the FAQ about ImTextureID! See https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT in imconfig.h).
+//  [X] Renderer: Per draw list 32-bit indices for large meshes (ImGuiBackendFlags_RendererHasIdx32).
 
 // Important: on 32-bit systems, user texture binding is only supported if your imconfig file has '#define ImTextureID ImU64'.
 // See imgui_impl_vulkan.cpp file for details.
@@ -58,7 +60,7 @@ struct ImGui_ImplVulkan_InitInfo
     uint32_t                        QueueFamily;
     VkQueue                         Queue;
     VkPipelineCache                 PipelineCache;
-    VkDescriptorPool                DescriptorPool;
+    VkDescriptorPool                DescriptorPool;         // Optional. Used by ImGui_ImplVulkan_AddTexture() until full, after which (or if VK_NULL_HANDLE) the backend creates and grows its own pools.
     uint32_t                        Subpass;
     uint32_t                        MinImageCount;          // >= 2
     uint32_t                        ImageCount;             // >= MinImageCount
@@ -71,6 +73,21 @@ struct ImGui_ImplVulkan_InitInfo
     // Allocation, Debugging
     const VkAllocationCallbacks*    Allocator;
     void                            (*CheckVkResultFn)(VkResult err);
+    VkDeviceSize                    UploadBufferSize;       // Initial size of the persistently mapped ring buffer used to upload vertices/indices (0 -> default to 256 KB). Grows as needed.
+};
+
+// Statistics for the last call to ImGui_ImplVulkan_RenderDrawData(), see ImGui_ImplVulkan_GetRenderStats()
+struct ImGui_ImplVulkan_RenderStats
+{
+    VkDeviceSize                    UploadBytes;                // Vertex and index bytes written to the upload ring buffer
+    VkDeviceSize                    UploadBufferSize;           // Current size of the upload ring buffer
+    VkDeviceSize                    UploadBufferUsed;           // Bytes of the upload ring buffer used by in-flight frames, including this one
+    uint32_t                        UploadBufferGrowCount;      // Number of times the upload ring buffer had to be replaced by a larger one since initialization. Each growth allocates device memory while recording: a potential stall.
+    bool                            UploadBufferGrewThisFrame;  // Upload ring buffer grew during this call
+    uint32_t                        DrawCmdCount;               // Non-callback ImDrawCmd processed (excluding fully clipped ones)
+    uint32_t                        DrawCallCount;              // vkCmdDrawIndexed() calls. Consecutive commands with same texture, scissor and contiguous indices are merged.
+    uint32_t                        DescriptorSetBindCount;     // vkCmdBindDescriptorSets() calls, redundant binds are skipped
+    uint32_t                        ScissorSetCount;            // vkCmdSetScissor() calls, redundant changes are skipped
 };
 
 // Called by user code
@@ -81,6 +98,7 @@ IMGUI_IMPL_API void         ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_dat
 IMGUI_IMPL_API bool         ImGui_ImplVulkan_CreateFontsTexture();
 IMGUI_IMPL_API void         ImGui_ImplVulkan_DestroyFontsTexture();
 IMGUI_IMPL_API void         ImGui_ImplVulkan_SetMinImageCount(uint32_t min_image_count); // To override MinImageCount after initialization (e.g. if swap chain is recreated)
+IMGUI_IMPL_API void         ImGui_ImplVulkan_GetRenderStats(ImGui_ImplVulkan_RenderStats* out_stats);
 
 // Register a texture (VkDescriptorSet == ImTextureID)
 // FIXME: This is experimental in the sense that we are unsure how to best design/tackle this problem
@@ -0,0 +1,4 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+@REM Benchmarks are only meaningful with optimizations enabled, so we build in Release.
+mkdir Release
+cl /nologo /Zi /MD /O2 /DNDEBUG /utf-8 /I ..\.. %* *.cpp ..\..\*.cpp /FeRelease/example_null_benchmark.exe /FoRelease/ /link gdi32.lib shell32.lib imm32.lib
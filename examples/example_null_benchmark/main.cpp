@@ -0,0 +1,888 @@
+// dear imgui: "null" benchmark application
+// (compile and link imgui, run synthetic workloads headless with NO INPUTS, NO GRAPHICS OUTPUT, report timings)
+// This is used to catch performance regressions in core imgui code. Build with optimizations enabled!
+//
+// Usage: example_null_benchmark [options]
+//   --frames N          Number of measured frames per workload (default: 60)
+//   --warmup N          Number of frames to run before measuring (default: 5)
+//   --filter STR        Only run workloads whose name contains STR
+//   --json FILE         Write results to FILE as JSON ("-" for stdout)
+//   --baseline FILE     Compare results to FILE (written by a previous --json run). Exit code is 1 on regression.
+//   --threshold PCT     Allowed slowdown in percent when comparing timings to baseline (default: 10)
+//
+// Notes:
+// - Each workload runs in its own context with a fixed display size and delta time, no inputs and no .ini file, so that results are reproducible.
+// - Timings are measured per phase: NewFrame(), building the UI (user code) and Render(). Comparisons use the median frame time, which is less sensitive to noise.
+// - Vertex/index/command counts, allocation counts and latencies in frames are deterministic: any increase is reported as a regression.
+// - Once warmed up, frames are expected to perform zero heap allocations (buffers are retained across frames). Exit code is 1 when
+//   a workload which isn't flagged as allocating (e.g. loading settings) allocates during measured frames.
+
+#include "imgui.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>         // intptr_t
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+// Count allocations made by imgui (installed with ImGui::SetAllocatorFunctions())
+struct AllocCounters
+{
+    int     AllocCount;
+    size_t  AllocBytes;
+};
+static AllocCounters g_AllocCounters = {};
+
+static void* CountingMalloc(size_t size, void* user_data)
+{
+    AllocCounters* counters = (AllocCounters*)user_data;
+    counters->AllocCount++;
+    counters->AllocBytes += size;
+    return malloc(size);
+}
+
+static void CountingFree(void* ptr, void* user_data)
+{
+    IM_UNUSED(user_data);
+    free(ptr);
+}
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Input latency reported by workloads (e.g. from a key press being queued to the frame which shows its effect), reset before measured frames
+struct LatencyCounters
+{
+    int     Count;
+    double  FramesSum;
+    double  MsSum;
+};
+static LatencyCounters g_LatencyCounters = {};
+
+static void AddLatencySample(int frames, double ms)
+{
+    g_LatencyCounters.Count++;
+    g_LatencyCounters.FramesSum += frames;
+    g_LatencyCounters.MsSum += ms;
+}
+
+static int CompareDoubles(const void* lhs, const void* rhs)
+{
+    const double a = *(const double*)lhs;
+    const double b = *(const double*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+// Workloads
+//-----------------------------------------------------------------------------
+
+static void BeginFullscreenWindow(const char* name)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoSavedSettings);
+}
+
+static void Workload_Buttons(int)
+{
+    BeginFullscreenWindow("Buttons");
+    for (int n = 0; n < 10000; n++)
+    {
+        ImGui::PushID(n);
+        ImGui::Button("Button");
+        if ((n % 10) != 9)
+            ImGui::SameLine();
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+static void Workload_Tables(int)
+{
+    BeginFullscreenWindow("Tables");
+    for (int table_n = 0; table_n < 100; table_n++)
+    {
+        ImGui::PushID(table_n);
+        if (ImGui::BeginTable("table", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable))
+        {
+            ImGui::TableSetupColumn("ID");
+            ImGui::TableSetupColumn("Name");
+            ImGui::TableSetupColumn("Value");
+            ImGui::TableHeadersRow();
+            for (int row_n = 0; row_n < 1000; row_n++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%04d", row_n);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Item");
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", row_n * 0.5f);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+static ImGuiTextBuffer g_BigText;
+
+static void Workload_BigText(int)
+{
+    if (g_BigText.empty())
+        for (int line_n = 0; line_n < 20000; line_n++)
+            g_BigText.appendf("%05d The quick brown fox jumps over the lazy dog. 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ\n", line_n);
+    BeginFullscreenWindow("BigText");
+    ImGui::TextUnformatted(g_BigText.begin(), g_BigText.end());
+    ImGui::PushTextWrapPos(600.0f);
+    ImGui::TextUnformatted(g_BigText.begin(), g_BigText.begin() + 64 * 1024);
+    ImGui::PopTextWrapPos();
+    ImGui::End();
+}
+
+static void Workload_DeepTree(int)
+{
+    BeginFullscreenWindow("DeepTree");
+    const int depth = 64;
+    int opened = 0;
+    for (int level = 0; level < depth; level++)
+    {
+        for (int leaf_n = 0; leaf_n < 8; leaf_n++)
+            ImGui::BulletText("Leaf %d.%d", level, leaf_n);
+        ImGui::SetNextItemOpen(true, ImGuiCond_Always);
+        if (!ImGui::TreeNode((void*)(intptr_t)level, "Node %d", level))
+            break;
+        opened++;
+    }
+    for (int n = 0; n < opened; n++)
+        ImGui::TreePop();
+    ImGui::End();
+}
+
+static void Workload_DrawListShapes(int frame)
+{
+    BeginFullscreenWindow("DrawListShapes");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < 2000; n++)
+    {
+        const float x = p.x + (float)((n * 37 + frame) % 1800);
+        const float y = p.y + (float)((n * 53) % 1000);
+        const ImU32 col = IM_COL32(n & 255, (n * 7) & 255, (n * 13) & 255, 255);
+        draw_list->AddRectFilled(ImVec2(x, y), ImVec2(x + 20.0f, y + 12.0f), col, 4.0f);
+        draw_list->AddRect(ImVec2(x, y), ImVec2(x + 24.0f, y + 16.0f), col, 4.0f, 0, 1.5f);
+        draw_list->AddCircleFilled(ImVec2(x + 10.0f, y + 30.0f), 8.0f, col);
+        draw_list->AddCircle(ImVec2(x + 10.0f, y + 30.0f), 12.0f, col, 0, 2.0f);
+        draw_list->AddLine(ImVec2(x, y), ImVec2(x + 40.0f, y + 25.0f), col, 1.0f);
+        draw_list->AddBezierCubic(ImVec2(x, y), ImVec2(x + 10.0f, y - 20.0f), ImVec2(x + 30.0f, y + 20.0f), ImVec2(x + 40.0f, y), col, 1.0f);
+        draw_list->AddNgonFilled(ImVec2(x + 30.0f, y + 30.0f), 6.0f, col, 6);
+    }
+    ImGui::End();
+}
+
+// Same with circles and rounded rectangles rendered from baked atlas tiles (opt-in, latched by next NewFrame())
+static void Workload_DrawListShapesTex(int frame)
+{
+    ImGui::GetStyle().AntiAliasedFillUseTex = true;
+    Workload_DrawListShapes(frame);
+}
+
+// Regression check for ImGuiBackendFlags_RendererHasIdx32 without ImGuiBackendFlags_RendererHasVtxOffset (e.g. OpenGL ES 3.0):
+// AddText() reserves 4 vertices per character including whitespace, which splits the list with ImDrawCmd::VtxOffset, then
+// PrimUnreserve() brings it back under 64K vertices. The list must still be promoted, otherwise Render() asserts.
+static void Workload_DrawListUnreserveIdx32(int)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags = (io.BackendFlags & ~ImGuiBackendFlags_RendererHasVtxOffset) | ImGuiBackendFlags_RendererHasIdx32;
+
+    static char text[1 + 3000 + 1] = "";
+    if (text[0] == 0)
+    {
+        memset(text, ' ', sizeof(text) - 1);
+        text[0] = 'A';
+    }
+    BeginFullscreenWindow("DrawListUnreserveIdx32");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < 15000; n++) // 60000 vertices
+    {
+        const float x = p.x + (float)(n % 1000);
+        const float y = p.y + (float)(n / 1000) * 10.0f;
+        draw_list->AddRectFilled(ImVec2(x, y), ImVec2(x + 1.0f, y + 5.0f), IM_COL32(n & 255, 128, 255, 255));
+    }
+    draw_list->AddText(ImVec2(p.x, p.y + 200.0f), IM_COL32_WHITE, text);
+    ImGui::End();
+}
+
+// Scatter plot markers: 100K circles and 100K rectangles, submitted one by one or with the batched primitives
+struct ScatterData
+{
+    ImVector<ImVec2>    Centers;
+    ImVector<ImVec2>    RectMin;
+    ImVector<ImVec2>    RectMax;
+    ImVector<ImU32>     Colors;
+};
+static ScatterData g_Scatter;
+
+static void Scatter_Update(int frame)
+{
+    const int count = 100000;
+    g_Scatter.Centers.resize(count);
+    g_Scatter.RectMin.resize(count);
+    g_Scatter.RectMax.resize(count);
+    g_Scatter.Colors.resize(count);
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < count; n++)
+    {
+        const float x = p.x + (float)((n * 37 + frame) % 1800);
+        const float y = p.y + (float)((n * 53) % 1000);
+        g_Scatter.Centers[n] = ImVec2(x, y);
+        g_Scatter.RectMin[n] = ImVec2(x + 5.0f, y - 2.0f);
+        g_Scatter.RectMax[n] = ImVec2(x + 9.0f, y + 2.0f);
+        g_Scatter.Colors[n] = IM_COL32(n & 255, (n * 7) & 255, (n * 13) & 255, 255);
+    }
+}
+
+static void Workload_Scatter(int frame)
+{
+    BeginFullscreenWindow("Scatter");
+    Scatter_Update(frame);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    for (int n = 0; n < g_Scatter.Centers.Size; n++)
+        draw_list->AddCircleFilled(g_Scatter.Centers[n], 3.0f, g_Scatter.Colors[n]);
+    for (int n = 0; n < g_Scatter.Centers.Size; n++)
+        draw_list->AddRectFilled(g_Scatter.RectMin[n], g_Scatter.RectMax[n], g_Scatter.Colors[n]);
+    ImGui::End();
+}
+
+static void Workload_ScatterBatched(int frame)
+{
+    BeginFullscreenWindow("Scatter");
+    Scatter_Update(frame);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    draw_list->AddCirclesFilled(g_Scatter.Centers.Data, g_Scatter.Centers.Size, 3.0f, 0, g_Scatter.Colors.Data);
+    draw_list->AddRectsFilled(g_Scatter.RectMin.Data, g_Scatter.RectMax.Data, g_Scatter.Centers.Size, 0, g_Scatter.Colors.Data);
+    ImGui::End();
+}
+
+static void Workload_ScatterBatchedTex(int frame)
+{
+    ImGui::GetStyle().AntiAliasedFillUseTex = true;
+    Workload_ScatterBatched(frame);
+}
+
+// Node editor links: 20K auto-tessellated bezier curves, 1 in 100 moving every frame
+static void Workload_BezierLinks(int frame)
+{
+    BeginFullscreenWindow("BezierLinks");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < 20000; n++)
+    {
+        const float x1 = p.x + (float)((n * 37) % 1600);
+        const float y1 = p.y + (float)((n * 53) % 1000);
+        const float x2 = x1 + 300.0f + (float)(n % 500);
+        const float y2 = y1 + (float)((n * 7) % 600) - 300.0f + ((n % 100) == 0 ? (float)(frame % 50) : 0.0f);
+        const float dx = (x2 - x1) * 0.5f;
+        const ImU32 col = IM_COL32(n & 255, (n * 7) & 255, (n * 13) & 255, 255);
+        draw_list->AddBezierCubic(ImVec2(x1, y1), ImVec2(x1 + dx, y1), ImVec2(x2 - dx, y2), ImVec2(x2, y2), col, 1.5f);
+    }
+    ImGui::End();
+}
+
+static void Workload_BezierLinksCached(int frame)
+{
+    ImGui::GetIO().ConfigDrawListCurveCache = true; // Applied from next frame, warmup frames take care of it
+    Workload_BezierLinks(frame);
+}
+
+// Telemetry: 10M samples plotted with PlotLines(), sampled (1 value per column) or from a min/max pyramid, appending 10K samples per frame
+static ImVector<float> g_Telemetry;
+
+static void Telemetry_Update(int frame)
+{
+    const int count = 10000000 + frame * 10000;
+    while (g_Telemetry.Size < count)
+    {
+        const float t = (float)g_Telemetry.Size * 0.0001f;
+        g_Telemetry.push_back(sinf(t) + 0.5f * sinf(t * 13.0f));
+    }
+}
+
+static void Workload_PlotLines(int frame)
+{
+    BeginFullscreenWindow("PlotLines");
+    Telemetry_Update(frame);
+    ImGui::PlotLines("Telemetry", g_Telemetry.Data, g_Telemetry.Size, 0, NULL, FLT_MAX, FLT_MAX, ImVec2(1800.0f, 400.0f));
+    ImGui::End();
+}
+
+static void Workload_PlotLinesLod(int frame)
+{
+    static ImGuiPlotLod lod; // Kept across workloads, only used by this one
+    if (frame == 0)
+        lod.Clear();
+    BeginFullscreenWindow("PlotLines");
+    Telemetry_Update(frame);
+    ImGui::PlotLines("Telemetry", g_Telemetry.Data, g_Telemetry.Size, &lod, NULL, FLT_MAX, FLT_MAX, ImVec2(1800.0f, 400.0f));
+    ImGui::End();
+}
+
+static void Settings_BuildIni(ImGuiTextBuffer* ini, int windows_count, int tables_count)
+{
+    ini->clear();
+    for (int n = 0; n < windows_count; n++)
+        ini->appendf("[Window][Window %d]\nPos=%d,%d\nSize=400,300\n\n", n, n % 1000, n % 700);
+    for (int n = 0; n < tables_count; n++)
+        ini->appendf("[Table][0x%08X,4]\nRefScale=13\nColumn 0  Width=%d\nColumn 1  Weight=1.0000 Sort=0v\nColumn 2  Weight=1.0000\nColumn 3  Weight=1.0000\n\n", (unsigned int)n * 2654435761u + 1, 40 + n % 100);
+}
+
+// Startup: load settings for 25K windows + 25K tables into a new context, every frame
+static void Workload_SettingsLoad(int frame)
+{
+    static ImGuiTextBuffer ini;
+    if (frame == 0)
+        Settings_BuildIni(&ini, 25000, 25000);
+    ImGuiContext* prev_ctx = ImGui::GetCurrentContext();
+    ImGuiContext* ctx = ImGui::CreateContext(ImGui::GetIO().Fonts);
+    ImGui::GetIO().IniFilename = nullptr;
+    ImGui::LoadIniSettingsFromMemory(ini.c_str(), (size_t)ini.size());
+    ImGui::DestroyContext(ctx);
+    ImGui::SetCurrentContext(prev_ctx);
+}
+
+// Settings for 10K windows + 10K tables, one window moving every frame and settings saved every frame (as if io.IniSavingRate was elapsed)
+static void Settings_LoadAndSave(int frame)
+{
+    if (frame == 0)
+    {
+        ImGuiTextBuffer ini;
+        Settings_BuildIni(&ini, 10000, 10000);
+        ImGui::LoadIniSettingsFromMemory(ini.c_str(), (size_t)ini.size());
+    }
+    ImGui::SetNextWindowPos(ImVec2((float)(frame % 100), 0.0f));
+    ImGui::Begin("Window 0");
+    ImGui::End();
+
+    size_t ini_size = 0;
+    ImGui::SaveIniSettingsToMemory(&ini_size);
+}
+
+static void Workload_SettingsSave(int frame)
+{
+    Settings_LoadAndSave(frame);
+}
+
+static void Workload_SettingsSaveBinary(int frame)
+{
+    ImGui::GetIO().IniSavingBinary = true;
+    Settings_LoadAndSave(frame);
+}
+
+// Capture 20K text items in a tree with LogToFile(), output is received by io.LogWriteFn instead of being written to disk
+static size_t g_LogWriteBytes = 0;
+
+static void LogWriteFn(void*, const char*, const char* data, size_t size)
+{
+    if (data != nullptr)
+        g_LogWriteBytes += size;
+}
+
+static void Workload_LogToFile(int)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.LogWriteFn = LogWriteFn;
+    BeginFullscreenWindow("LogToFile");
+    ImGui::LogToFile(2, "benchmark_log.txt");
+    for (int i = 0; i < 100; i++)
+    {
+        ImGui::SetNextItemOpen(true);
+        if (ImGui::TreeNode((void*)(intptr_t)i, "Node %d", i))
+        {
+            for (int j = 0; j < 200; j++)
+                ImGui::Text("Item %d/%d: value = %.3f", i, j, j * 0.001f);
+            ImGui::TreePop();
+        }
+    }
+    ImGui::LogFinish();
+    ImGui::End();
+}
+
+// Keyboard navigation in a grid of 50k items: a move request is submitted every other frame
+// Also reports nav move latency: frames and time from a key press being queued to the frame where the focused cell has changed.
+static void Workload_NavGrid(int frame)
+{
+    static int focused_cell = -1;
+    static int press_frame = -1;
+    static double press_time = 0.0;
+    if (frame == 0)
+        focused_cell = press_frame = -1;
+
+    BeginFullscreenWindow("NavGrid");
+    int new_focused_cell = -1;
+    for (int row = 0; row < 1000; row++)
+        for (int column = 0; column < 50; column++)
+        {
+            ImGui::PushID(row * 50 + column);
+            if (column > 0)
+                ImGui::SameLine();
+            ImGui::Selectable("##cell", false, 0, ImVec2(30.0f, 0.0f));
+            if (ImGui::IsItemFocused())
+                new_focused_cell = row * 50 + column;
+            ImGui::PopID();
+        }
+    ImGui::End();
+    if (new_focused_cell != focused_cell && press_frame != -1)
+    {
+        AddLatencySample(frame - press_frame, GetTimeMs() - press_time);
+        press_frame = -1;
+    }
+    focused_cell = new_focused_cell;
+
+    // Queue input for next frame
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    const ImGuiKey keys[] = { ImGuiKey_DownArrow, ImGuiKey_RightArrow, ImGuiKey_DownArrow, ImGuiKey_RightArrow, ImGuiKey_PageDown };
+    const bool press = (frame & 1) == 0;
+    io.AddKeyEvent(keys[(frame / 2) % IM_ARRAYSIZE(keys)], press);
+    if (press && focused_cell != -1)
+    {
+        press_frame = frame;
+        press_time = GetTimeMs();
+    }
+}
+
+// Typical interactions cycling every 24 frames: copy/paste in a text field, popup, tooltip, drag and drop, window appearing.
+// Once every path has been taken (see warmup), frames should not allocate anymore.
+static const int INTERACTIONS_CYCLE = 24;
+static ImVec2 g_InteractionsInputPos, g_InteractionsSourcePos, g_InteractionsTargetPos;
+
+static void Workload_Interactions(int frame)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const int step = frame % INTERACTIONS_CYCLE;
+    switch (step)
+    {
+    case 0: io.AddMousePosEvent(g_InteractionsInputPos.x, g_InteractionsInputPos.y); break;
+    case 1: io.AddMouseButtonEvent(0, true); break;
+    case 2: io.AddMouseButtonEvent(0, false); break;
+    case 3: io.AddKeyEvent(ImGuiMod_Ctrl, true); io.AddKeyEvent(ImGuiKey_A, true); break;         // Select all
+    case 4: io.AddKeyEvent(ImGuiKey_A, false); io.AddKeyEvent(ImGuiKey_C, true); break;           // Copy
+    case 5: io.AddKeyEvent(ImGuiKey_C, false); io.AddKeyEvent(ImGuiKey_V, true); break;           // Paste over selection
+    case 6: io.AddKeyEvent(ImGuiKey_V, false); io.AddKeyEvent(ImGuiMod_Ctrl, false); break;
+    case 7: io.AddKeyEvent(ImGuiKey_Escape, true); break;
+    case 8: io.AddKeyEvent(ImGuiKey_Escape, false); break;
+    case 14: io.AddMousePosEvent(g_InteractionsSourcePos.x, g_InteractionsSourcePos.y); break;
+    case 15: io.AddMouseButtonEvent(0, true); break;
+    case 16: case 17: case 18: io.AddMousePosEvent(g_InteractionsSourcePos.x + (step - 15) * 20.0f, g_InteractionsSourcePos.y + (step - 15) * 20.0f); break;
+    case 19: io.AddMousePosEvent(g_InteractionsTargetPos.x, g_InteractionsTargetPos.y); break;
+    case 20: io.AddMouseButtonEvent(0, false); break;
+    }
+
+    static char text[64] = "Hello, world!";
+    static unsigned char payload[64] = {};
+    BeginFullscreenWindow("Interactions");
+    ImGui::InputText("Text", text, IM_ARRAYSIZE(text));
+    g_InteractionsInputPos = ImVec2(ImGui::GetItemRectMin().x + 10.0f, ImGui::GetItemRectMin().y + 5.0f);
+    if (step == 9)
+        ImGui::OpenPopup("Popup");
+    if (ImGui::BeginPopup("Popup"))
+    {
+        ImGui::Text("Popup, step %d", step);
+        if (step == 13)
+            ImGui::CloseCurrentPopup();
+        ImGui::EndPopup();
+    }
+    if (step >= 10 && step < 13)
+        ImGui::SetTooltip("Tooltip, step %d", step);
+    ImGui::Button("Source");
+    g_InteractionsSourcePos = ImVec2(ImGui::GetItemRectMin().x + 5.0f, ImGui::GetItemRectMin().y + 5.0f);
+    if (ImGui::BeginDragDropSource())
+    {
+        ImGui::SetDragDropPayload("PAYLOAD", payload, sizeof(payload)); // Larger than the inline buffer
+        ImGui::Text("Dragging");
+        ImGui::EndDragDropSource();
+    }
+    ImGui::Button("Target", ImVec2(200.0f, 200.0f));
+    g_InteractionsTargetPos = ImVec2(ImGui::GetItemRectMin().x + 100.0f, ImGui::GetItemRectMin().y + 100.0f);
+    if (ImGui::BeginDragDropTarget())
+    {
+        ImGui::AcceptDragDropPayload("PAYLOAD");
+        ImGui::EndDragDropTarget();
+    }
+    ImGui::End();
+
+    if (step < INTERACTIONS_CYCLE / 2)
+    {
+        ImGui::SetNextWindowPos(ImVec2(1000.0f, 100.0f));
+        ImGui::Begin("Transient", nullptr, ImGuiWindowFlags_NoSavedSettings);
+        if (ImGui::BeginTable("Table", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_Sortable))
+        {
+            for (int column = 0; column < 4; column++)
+                ImGui::TableSetupColumn("Column");
+            ImGui::TableHeadersRow();
+            for (int cell = 0; cell < 40; cell++)
+            {
+                ImGui::TableNextColumn();
+                ImGui::Text("Cell %d", cell);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
+}
+
+static void Workload_FontAtlasBuild(int)
+{
+    ImFontAtlas atlas;
+    ImFontConfig font_cfg;
+    for (int n = 0; n < 4; n++)
+    {
+        font_cfg.SizePixels = 13.0f + n * 4.0f;
+        atlas.AddFontDefault(&font_cfg);
+    }
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    atlas.GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+}
+
+static void Workload_DemoWindow(int)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::SetNextWindowCollapsed(false);
+    ImGui::ShowDemoWindow(nullptr);
+}
+
+struct Workload
+{
+    const char* Name;
+    void        (*Func)(int frame);
+    bool        Allocates;          // Workload is expected to allocate every frame (e.g. loading settings, building a font atlas)
+    int         MinWarmup;          // Minimum number of warmup frames (e.g. to go through every interaction once)
+};
+
+static const Workload g_Workloads[] =
+{
+    { "buttons_10k",        Workload_Buttons,                false, 0 },
+    { "tables_100x1k",      Workload_Tables,                 false, 0 },
+    { "big_text",           Workload_BigText,                false, 0 },
+    { "deep_tree",          Workload_DeepTree,               false, 0 },
+    { "drawlist_shapes",    Workload_DrawListShapes,         false, 0 },
+    { "drawlist_shapes_tex", Workload_DrawListShapesTex,     false, 1 }, // style.AntiAliasedFillUseTex is latched by NewFrame()
+    { "drawlist_idx32_unres", Workload_DrawListUnreserveIdx32, false, 1 }, // io.BackendFlags are latched by NewFrame()
+    { "scatter_200k",       Workload_Scatter,                false, 0 },
+    { "scatter_200k_batch", Workload_ScatterBatched,         false, 0 },
+    { "scatter_200k_tex",   Workload_ScatterBatchedTex,      false, 1 },
+    { "bezier_20k",         Workload_BezierLinks,            false, 0 },
+    { "bezier_20k_cache",   Workload_BezierLinksCached,      false, 60 }, // Animated curves cycle every 50 frames, then are all cached
+    { "plot_10m",           Workload_PlotLines,              false, 0 },
+    { "plot_10m_lod",       Workload_PlotLinesLod,           false, 0 },
+    { "ini_load_50k",       Workload_SettingsLoad,           true,  0 },
+    { "ini_save_20k",       Workload_SettingsSave,           false, 0 },
+    { "ini_save_20k_bin",   Workload_SettingsSaveBinary,     false, 0 },
+    { "log_to_file_20k",    Workload_LogToFile,              false, 0 },
+    { "nav_grid_50k",       Workload_NavGrid,                false, 10 }, // Nav item index is filled once nav is engaged by the first key presses
+    { "interactions",       Workload_Interactions,           false, INTERACTIONS_CYCLE * 2 }, // First cycle doesn't know where to click yet
+    { "font_atlas_build",   Workload_FontAtlasBuild,         true,  0 },
+    { "demo_window",        Workload_DemoWindow,             false, 0 },
+};
+
+//-----------------------------------------------------------------------------
+// Running and reporting
+//-----------------------------------------------------------------------------
+
+enum Phase { Phase_NewFrame, Phase_Build, Phase_Render, Phase_COUNT };
+static const char* g_PhaseNames[Phase_COUNT] = { "newframe", "build", "render" };
+
+struct WorkloadResult
+{
+    char        Name[64];
+    double      PhaseMsMean[Phase_COUNT];
+    double      TotalMsMean;
+    double      TotalMsMin;
+    double      TotalMsMedian;
+    double      TotalMsMax;
+    double      AllocsPerFrame;
+    double      AllocBytesPerFrame;
+    int         VtxCount;           // Last frame
+    int         VtxBytes;           // Last frame, VtxCount * sizeof(ImDrawVert): what a renderer backend uploads
+    int         IdxCount;
+    int         CmdCount;
+    int         CmdListsCount;
+    int         LatencyCount;       // Number of latency samples reported by the workload (0 if not measured)
+    double      LatencyFramesMean;  // Frames from input being queued to the frame showing its effect
+    double      LatencyMsMean;
+};
+
+static void RunWorkload(const Workload* workload, int frames, int warmup, WorkloadResult* out)
+{
+    memset(out, 0, sizeof(*out));
+    snprintf(out->Name, sizeof(out->Name), "%s", workload->Name);
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // Most renderer backends support this, allowing large meshes with 16-bit indices
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    if (warmup < workload->MinWarmup)
+        warmup = workload->MinWarmup;
+    ImVector<double> totals;
+    totals.reserve(frames); // Don't count our own allocations in measured frames
+    for (int frame = 0; frame < warmup + frames; frame++)
+    {
+        const bool measure = (frame >= warmup);
+        if (frame == warmup)
+            memset(&g_LatencyCounters, 0, sizeof(g_LatencyCounters));
+        const AllocCounters allocs_before = g_AllocCounters;
+        double t[Phase_COUNT + 1];
+        t[0] = GetTimeMs();
+        ImGui::NewFrame();
+        t[1] = GetTimeMs();
+        workload->Func(frame);
+        t[2] = GetTimeMs();
+        ImGui::Render();
+        t[3] = GetTimeMs();
+        if (!measure)
+            continue;
+
+        for (int phase = 0; phase < Phase_COUNT; phase++)
+            out->PhaseMsMean[phase] += t[phase + 1] - t[phase];
+        totals.push_back(t[Phase_COUNT] - t[0]);
+        out->AllocsPerFrame += g_AllocCounters.AllocCount - allocs_before.AllocCount;
+        out->AllocBytesPerFrame += (double)(g_AllocCounters.AllocBytes - allocs_before.AllocBytes);
+
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        out->VtxCount = draw_data->TotalVtxCount;
+        out->VtxBytes = draw_data->TotalVtxCount * (int)sizeof(ImDrawVert);
+        out->IdxCount = draw_data->TotalIdxCount;
+        out->CmdListsCount = draw_data->CmdListsCount;
+        out->CmdCount = 0;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            out->CmdCount += draw_data->CmdLists[n]->CmdBuffer.Size;
+    }
+    ImGui::DestroyContext();
+
+    for (int phase = 0; phase < Phase_COUNT; phase++)
+        out->PhaseMsMean[phase] /= frames;
+    out->AllocsPerFrame /= frames;
+    out->AllocBytesPerFrame /= frames;
+    qsort(totals.Data, (size_t)totals.Size, sizeof(double), CompareDoubles);
+    for (double total : totals)
+        out->TotalMsMean += total;
+    out->TotalMsMean /= frames;
+    out->TotalMsMin = totals[0];
+    out->TotalMsMedian = totals[totals.Size / 2];
+    out->TotalMsMax = totals[totals.Size - 1];
+    out->LatencyCount = g_LatencyCounters.Count;
+    if (g_LatencyCounters.Count > 0)
+    {
+        out->LatencyFramesMean = g_LatencyCounters.FramesSum / g_LatencyCounters.Count;
+        out->LatencyMsMean = g_LatencyCounters.MsSum / g_LatencyCounters.Count;
+    }
+}
+
+// One workload per line, so that baseline files can be parsed back with a simple line-based reader.
+static void WriteJson(FILE* f, const ImVector<WorkloadResult>& results, int frames, int warmup)
+{
+    fprintf(f, "{\n");
+    fprintf(f, "  \"imgui_version\": \"%s\", \"imgui_version_num\": %d, \"frames\": %d, \"warmup\": %d, \"sizeof_drawvert\": %d,\n", IMGUI_VERSION, IMGUI_VERSION_NUM, frames, warmup, (int)sizeof(ImDrawVert));
+    fprintf(f, "  \"workloads\": [\n");
+    for (int n = 0; n < results.Size; n++)
+    {
+        const WorkloadResult& r = results[n];
+        fprintf(f, "    { \"name\": \"%s\"", r.Name);
+        for (int phase = 0; phase < Phase_COUNT; phase++)
+            fprintf(f, ", \"%s_ms\": %.4f", g_PhaseNames[phase], r.PhaseMsMean[phase]);
+        fprintf(f, ", \"total_ms\": %.4f, \"total_ms_min\": %.4f, \"total_ms_median\": %.4f, \"total_ms_max\": %.4f", r.TotalMsMean, r.TotalMsMin, r.TotalMsMedian, r.TotalMsMax);
+        fprintf(f, ", \"allocs_per_frame\": %.2f, \"alloc_bytes_per_frame\": %.0f", r.AllocsPerFrame, r.AllocBytesPerFrame);
+        fprintf(f, ", \"vtx_count\": %d, \"vtx_bytes\": %d, \"idx_count\": %d, \"cmd_count\": %d, \"cmd_lists_count\": %d", r.VtxCount, r.VtxBytes, r.IdxCount, r.CmdCount, r.CmdListsCount);
+        if (r.LatencyCount > 0)
+            fprintf(f, ", \"latency_frames\": %.2f, \"latency_ms\": %.4f", r.LatencyFramesMean, r.LatencyMsMean);
+        fprintf(f, " }%s\n", (n + 1 < results.Size) ? "," : "");
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+}
+
+static bool JsonLineGetString(const char* line, const char* key, char* out, size_t out_size)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\": \"", key);
+    const char* p = strstr(line, pattern);
+    if (p == nullptr)
+        return false;
+    p += strlen(pattern);
+    const char* p_end = strchr(p, '"');
+    if (p_end == nullptr || (size_t)(p_end - p) >= out_size)
+        return false;
+    memcpy(out, p, (size_t)(p_end - p));
+    out[p_end - p] = 0;
+    return true;
+}
+
+static bool JsonLineGetNumber(const char* line, const char* key, double* out)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\": ", key);
+    const char* p = strstr(line, pattern);
+    return p != nullptr && sscanf(p + strlen(pattern), "%lf", out) == 1;
+}
+
+// Returns number of regressions, or -1 if the baseline file couldn't be read
+static int CompareToBaseline(FILE* report, const char* filename, const ImVector<WorkloadResult>& results, double threshold_pct)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == nullptr)
+    {
+        fprintf(stderr, "Error: cannot open baseline file '%s'\n", filename);
+        return -1;
+    }
+
+    fprintf(report, "\nComparing to baseline '%s' (threshold: +%.1f%%)\n", filename, threshold_pct);
+    fprintf(report, "%-20s %12s %12s %9s   %s\n", "workload", "baseline_ms", "current_ms", "delta", "notes");
+    int regressions = 0;
+    char line[2048];
+    while (fgets(line, sizeof(line), f))
+    {
+        char name[64];
+        if (!JsonLineGetString(line, "name", name, sizeof(name)))
+            continue;
+        const WorkloadResult* r = nullptr;
+        for (const WorkloadResult& result : results)
+            if (strcmp(result.Name, name) == 0)
+                r = &result;
+        if (r == nullptr)
+            continue;
+
+        // Timings: allow some noise
+        double base_ms = 0.0;
+        JsonLineGetNumber(line, "total_ms_median", &base_ms);
+        const double delta_pct = (base_ms > 0.0) ? (r->TotalMsMedian - base_ms) * 100.0 / base_ms : 0.0;
+        char notes[256] = "";
+        bool regressed = false;
+        if (delta_pct > threshold_pct)
+        {
+            snprintf(notes, sizeof(notes), "SLOWER");
+            regressed = true;
+        }
+
+        // Deterministic counters: any increase is reported
+        struct { const char* Key; double Current; } counters[] =
+        {
+            { "allocs_per_frame",   r->AllocsPerFrame },
+            { "vtx_count",          (double)r->VtxCount },
+            { "idx_count",          (double)r->IdxCount },
+            { "cmd_count",          (double)r->CmdCount },
+            { "latency_frames",     r->LatencyFramesMean },
+        };
+        for (const auto& counter : counters)
+        {
+            double base_value = 0.0;
+            if (!JsonLineGetNumber(line, counter.Key, &base_value) || counter.Current <= base_value + 0.01)
+                continue;
+            const size_t len = strlen(notes);
+            snprintf(notes + len, sizeof(notes) - len, "%s%s %.0f -> %.0f", len ? ", " : "", counter.Key, base_value, counter.Current);
+            regressed = true;
+        }
+        fprintf(report, "%-20s %12.3f %12.3f %+8.1f%%   %s\n", name, base_ms, r->TotalMsMedian, delta_pct, notes);
+        if (regressed)
+            regressions++;
+    }
+    fclose(f);
+    fprintf(report, "%d regression(s)\n", regressions);
+    return regressions;
+}
+
+int main(int argc, char** argv)
+{
+    int frames = 60;
+    int warmup = 5;
+    double threshold_pct = 10.0;
+    const char* filter = nullptr;
+    const char* json_filename = nullptr;
+    const char* baseline_filename = nullptr;
+    for (int n = 1; n < argc; n++)
+    {
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(argv[n], "--frames") == 0 && has_value)          { frames = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--warmup") == 0 && has_value)     { warmup = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--filter") == 0 && has_value)     { filter = argv[++n]; }
+        else if (strcmp(argv[n], "--json") == 0 && has_value)       { json_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--baseline") == 0 && has_value)   { baseline_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--threshold") == 0 && has_value)  { threshold_pct = atof(argv[++n]); }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--filter STR] [--json FILE] [--baseline FILE] [--threshold PCT]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (frames < 1)
+        frames = 1;
+    if (warmup < 0)
+        warmup = 0;
+
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(CountingMalloc, CountingFree, &g_AllocCounters);
+
+    // Run workloads
+    ImVector<WorkloadResult> results;
+    const bool json_to_stdout = (json_filename != nullptr && strcmp(json_filename, "-") == 0);
+    FILE* report = json_to_stdout ? stderr : stdout;
+    fprintf(report, "Dear ImGui %s benchmark: %d frames (+%d warmup), sizeof(ImDrawVert) = %d\n", IMGUI_VERSION, frames, warmup, (int)sizeof(ImDrawVert));
+    fprintf(report, "%-20s %10s %10s %10s %10s %10s %10s %9s %10s %9s %7s\n", "workload", "newframe", "build", "render", "median", "max", "allocs/f", "vtx", "vtx bytes", "idx", "cmds");
+    int steady_state_allocating = 0;
+    for (const Workload& workload : g_Workloads)
+    {
+        if (filter != nullptr && strstr(workload.Name, filter) == nullptr)
+            continue;
+        WorkloadResult r;
+        RunWorkload(&workload, frames, warmup, &r);
+        const bool unexpected_allocs = (!workload.Allocates && r.AllocsPerFrame > 0.0);
+        fprintf(report, "%-20s %10.3f %10.3f %10.3f %10.3f %10.3f %10.1f %9d %10d %9d %7d%s\n", r.Name, r.PhaseMsMean[Phase_NewFrame], r.PhaseMsMean[Phase_Build], r.PhaseMsMean[Phase_Render], r.TotalMsMedian, r.TotalMsMax, r.AllocsPerFrame, r.VtxCount, r.VtxBytes, r.IdxCount, r.CmdCount, unexpected_allocs ? "   ALLOCATES" : "");
+        if (r.LatencyCount > 0)
+            fprintf(report, "%-20s latency: %.2f frames, %.3f ms (mean of %d samples)\n", "", r.LatencyFramesMean, r.LatencyMsMean, r.LatencyCount);
+        if (unexpected_allocs)
+            steady_state_allocating++;
+        results.push_back(r);
+    }
+    if (steady_state_allocating > 0)
+        fprintf(report, "%d workload(s) allocating memory after warmup\n", steady_state_allocating);
+    g_BigText.clear();
+    g_Telemetry.clear();
+
+    // Output
+    if (json_filename != nullptr)
+    {
+        FILE* f = json_to_stdout ? stdout : fopen(json_filename, "wb");
+        if (f == nullptr)
+        {
+            fprintf(stderr, "Error: cannot write to '%s'\n", json_filename);
+            return 2;
+        }
+        WriteJson(f, results, frames, warmup);
+        if (f != stdout)
+            fclose(f);
+    }
+    if (baseline_filename != nullptr)
+    {
+        const int regressions = CompareToBaseline(report, baseline_filename, results, threshold_pct);
+        if (regressions != 0)
+            return (regressions < 0) ? 2 : 1;
+    }
+    return (steady_state_allocating > 0) ? 1 : 0;
+}
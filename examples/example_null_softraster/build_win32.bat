@@ -0,0 +1,4 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+@REM The software rasterizer is much faster with optimizations enabled, so we build in Release.
+mkdir Release
+cl /nologo /Zi /MD /O2 /DNDEBUG /utf-8 /I ..\.. /I ..\..\backends %* *.cpp ..\..\backends\imgui_impl_softraster.cpp ..\..\*.cpp /FeRelease/example_null_softraster.exe /FoRelease/ /link gdi32.lib shell32.lib imm32.lib
@@ -0,0 +1,394 @@
+// dear imgui: "null" example application with the software rasterizer renderer
+// (compile and link imgui, run headless with NO INPUTS, render into a framebuffer in memory with imgui_impl_softraster)
+// This is used to render Dear ImGui without any GPU (headless servers, CI), to check rendering against reference images and measure fill-rate.
+//
+// Usage: example_null_softraster [options]
+//   --threads N         Number of threads used by the rasterizer (default: 0 = all hardware threads)
+//   --out FILE          Write the rendered image to FILE (.tga, run-length encoded)
+//   --compare FILE      Compare the rendered image to FILE (32-bit .tga, e.g. written by --out). Exit code is 1 when images differ.
+//   --tolerance N       Allowed difference per channel when comparing (default: 0)
+//   --diff FILE         When comparing, write an image of differences to FILE (.tga)
+//   --bench             Run fill-rate benchmark with increasing number of threads
+//   --frames N          Number of frames per benchmark scene (default: 60)
+//
+// Notes:
+// - The test scene uses a fixed display size, delta time, number of frames and no .ini file, so that the output is reproducible.
+// - The rasterizer output doesn't depend on the number of threads: comparing a --threads 1 image to a --threads N image must yield no difference.
+// - reference.tga in this folder is the reference image checked by CI (default ImDrawVert layout and style). When a change intentionally
+//   modifies the rendering of the test scene, review the --diff image then update it with: example_null_softraster --threads 1 --out reference.tga
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+static const int    FB_WIDTH = 1280;
+static const int    FB_HEIGHT = 720;
+static const ImU32  CLEAR_COLOR = IM_COL32(115, 140, 153, 255);
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void ClearFramebuffer(ImVector<ImU32>& fb)
+{
+    for (ImU32& pixel : fb)
+        pixel = CLEAR_COLOR;
+}
+
+// Write run-length encoded 32-bit TGA (top-left origin). Packets don't cross rows, as recommended by the format.
+static bool WriteTGA(const char* filename, const ImU32* pixels, int width, int height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == nullptr)
+        return false;
+    const unsigned char header[18] = { 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, (unsigned char)(width & 0xFF), (unsigned char)(width >> 8), (unsigned char)(height & 0xFF), (unsigned char)(height >> 8), 32, 0x28 };
+    fwrite(header, 1, sizeof(header), f);
+    ImVector<unsigned char> row;
+    row.reserve(width * 5);
+    for (int y = 0; y < height; y++)
+    {
+        row.resize(0);
+        const ImU32* src = &pixels[y * width];
+        for (int x = 0; x < width; )
+        {
+            // Run packet for 2+ identical pixels, otherwise raw packet up to the next run
+            int count = 1;
+            while (x + count < width && count < 128 && src[x + count] == src[x])
+                count++;
+            const bool run = (count > 1);
+            if (!run)
+                while (x + count < width && count < 128 && !(x + count + 1 < width && src[x + count] == src[x + count + 1]))
+                    count++;
+            row.push_back((unsigned char)((run ? 0x80 : 0x00) | (count - 1)));
+            for (int n = 0; n < (run ? 1 : count); n++)
+            {
+                const ImU32 c = src[x + n];
+                row.push_back((unsigned char)(c >> IM_COL32_B_SHIFT));
+                row.push_back((unsigned char)(c >> IM_COL32_G_SHIFT));
+                row.push_back((unsigned char)(c >> IM_COL32_R_SHIFT));
+                row.push_back((unsigned char)(c >> IM_COL32_A_SHIFT));
+            }
+            x += count;
+        }
+        fwrite(row.Data, 1, (size_t)row.Size, f);
+    }
+    fclose(f);
+    return true;
+}
+
+// Read 32-bit TGA, uncompressed or run-length encoded (as written by WriteTGA())
+static bool ReadTGA(const char* filename, ImVector<ImU32>& out_pixels, int* out_width, int* out_height)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == nullptr)
+        return false;
+    unsigned char header[18];
+    bool ok = fread(header, 1, sizeof(header), f) == sizeof(header) && (header[2] == 2 || header[2] == 10) && header[16] == 32;
+    const int width = header[12] | (header[13] << 8);
+    const int height = header[14] | (header[15] << 8);
+    const bool top_left_origin = (header[17] & 0x20) != 0;
+    const bool rle = (header[2] == 10);
+    if (ok)
+        ok = fseek(f, header[0], SEEK_CUR) == 0;
+    ImVector<unsigned char> data;
+    if (ok)
+    {
+        data.resize(width * height * 4);
+        if (!rle)
+            ok = fread(data.Data, 1, (size_t)data.Size, f) == (size_t)data.Size;
+        for (int n = 0; rle && ok && n < data.Size; )
+        {
+            const int packet = fgetc(f);
+            const int count = (packet & 0x7F) + 1;
+            if (packet == EOF || n + count * 4 > data.Size)
+                ok = false;
+            else if (packet & 0x80)
+            {
+                ok = fread(&data[n], 1, 4, f) == 4;
+                for (int i = 1; i < count; i++)
+                    memcpy(&data[n + i * 4], &data[n], 4);
+            }
+            else
+            {
+                ok = fread(&data[n], 1, (size_t)count * 4, f) == (size_t)count * 4;
+            }
+            n += count * 4;
+        }
+    }
+    fclose(f);
+    if (!ok)
+        return false;
+    out_pixels.resize(width * height);
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+        {
+            const unsigned char* p = &data[((top_left_origin ? y : height - 1 - y) * width + x) * 4];
+            out_pixels[y * width + x] = IM_COL32(p[2], p[1], p[0], p[3]);
+        }
+    *out_width = width;
+    *out_height = height;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Scenes
+//-----------------------------------------------------------------------------
+
+// Reference scene: demo window + a window exercising all primitive types (AA shapes, gradients, scaled/flipped images)
+static void ShowTestScene()
+{
+    ImGui::ShowDemoWindow(); // Default position and size: (650,20) 550x680
+
+    ImGui::SetNextWindowPos(ImVec2(20, 20));
+    ImGui::SetNextWindowSize(ImVec2(610, 680));
+    ImGui::Begin("Software Rasterizer Test");
+    ImGui::Text("Hello, world! %d", 123);
+    ImGui::Button("Button");
+    ImGui::SameLine();
+    static bool check = true;
+    ImGui::Checkbox("Checkbox", &check);
+    static float f = 0.4f;
+    ImGui::SliderFloat("Slider", &f, 0.0f, 1.0f);
+    ImGui::ProgressBar(0.6f);
+
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    ImVec2 p = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < 6; n++)
+    {
+        const float thickness = 1.0f + n * 1.5f;
+        const ImVec2 c(p.x + 40.0f + n * 95.0f, p.y + 40.0f);
+        draw_list->AddCircle(c, 30.0f, IM_COL32(255, 255, 0, 255), 0, thickness);
+        draw_list->AddCircleFilled(ImVec2(c.x, c.y + 80.0f), 30.0f, IM_COL32(255, 100, 100, 160));
+        draw_list->AddRect(ImVec2(c.x - 30.0f, c.y + 130.0f), ImVec2(c.x + 30.0f, c.y + 190.0f), IM_COL32(100, 255, 100, 255), 10.0f, 0, thickness);
+        draw_list->AddRectFilled(ImVec2(c.x - 30.0f, c.y + 200.0f), ImVec2(c.x + 30.0f, c.y + 260.0f), IM_COL32(100, 100, 255, 200), n * 5.0f);
+        draw_list->AddLine(ImVec2(c.x - 30.0f, c.y + 270.0f), ImVec2(c.x + 30.0f, c.y + 300.0f + n * 3.0f), IM_COL32(255, 255, 255, 255), thickness);
+        draw_list->AddBezierCubic(ImVec2(c.x - 30.0f, c.y + 310.0f), ImVec2(c.x, c.y + 280.0f), ImVec2(c.x, c.y + 370.0f), ImVec2(c.x + 30.0f, c.y + 340.0f), IM_COL32(255, 128, 0, 255), thickness);
+    }
+    draw_list->AddRectFilledMultiColor(ImVec2(p.x, p.y + 390.0f), ImVec2(p.x + 300.0f, p.y + 450.0f), IM_COL32(255, 0, 0, 255), IM_COL32(0, 255, 0, 255), IM_COL32(0, 0, 255, 128), IM_COL32(255, 255, 255, 0));
+    draw_list->AddTriangleFilled(ImVec2(p.x + 320.0f, p.y + 450.0f), ImVec2(p.x + 370.0f, p.y + 390.0f), ImVec2(p.x + 420.0f, p.y + 450.0f), IM_COL32(255, 0, 255, 255));
+
+    // Parts of the font atlas: at 1:1 (texel copy), scaled and flipped (bilinear quad), rounded and tinted (textured triangles)
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    const float tex_w = (float)atlas->TexWidth * 0.25f, tex_h = (float)atlas->TexHeight;
+    ImVec2 pos(p.x, p.y + 460.0f);
+    draw_list->AddImage(atlas->TexID, pos, ImVec2(pos.x + tex_w, pos.y + tex_h), ImVec2(0.0f, 0.0f), ImVec2(0.25f, 1.0f));
+    pos.x += tex_w + 10.0f;
+    draw_list->AddImage(atlas->TexID, pos, ImVec2(pos.x + tex_w * 1.5f, pos.y + tex_h * 1.5f), ImVec2(0.5f, 1.0f), ImVec2(0.25f, 0.0f));
+    pos.x += tex_w * 1.5f + 10.0f;
+    draw_list->AddImageRounded(atlas->TexID, pos, ImVec2(pos.x + tex_w, pos.y + tex_h), ImVec2(0.0f, 0.0f), ImVec2(0.25f, 1.0f), IM_COL32(255, 200, 200, 255), 10.0f);
+    ImGui::End();
+}
+
+// Benchmark scenes
+static void ShowBenchSceneFill()
+{
+    // 32 layers of translucent full-screen rectangles: measure blending fill-rate
+    ImDrawList* draw_list = ImGui::GetBackgroundDrawList();
+    for (int n = 0; n < 32; n++)
+        draw_list->AddRectFilled(ImVec2(0.0f, 0.0f), ImVec2((float)FB_WIDTH, (float)FB_HEIGHT), IM_COL32(n * 8, 255 - n * 8, 128, 32));
+}
+
+static void ShowBenchSceneText()
+{
+    ImDrawList* draw_list = ImGui::GetBackgroundDrawList();
+    const float line_height = ImGui::GetTextLineHeight();
+    for (float y = 0.0f; y < (float)FB_HEIGHT; y += line_height)
+        draw_list->AddText(ImVec2(0.0f, y), IM_COL32_WHITE, "The quick brown fox jumps over the lazy dog. 0123456789 !@#$%^&*() The quick brown fox jumps over the lazy dog. 0123456789 !@#$%^&*() The quick brown fox jumps over the lazy dog.");
+}
+
+static void ShowBenchSceneShapes()
+{
+    ImDrawList* draw_list = ImGui::GetBackgroundDrawList();
+    for (int y = 0; y < FB_HEIGHT; y += 40)
+        for (int x = 0; x < FB_WIDTH; x += 40)
+        {
+            draw_list->AddCircleFilled(ImVec2(x + 20.0f, y + 20.0f), 18.0f, IM_COL32(x & 255, y & 255, 200, 200));
+            draw_list->AddCircle(ImVec2(x + 20.0f, y + 20.0f), 18.0f, IM_COL32_WHITE, 0, 2.0f);
+        }
+}
+
+static void ShowBenchSceneDemo()
+{
+    ShowTestScene();
+}
+
+struct BenchScene
+{
+    const char* Name;
+    void        (*Func)();
+    int         LayersCount;        // Number of full-screen layers, to report a fill-rate (0 if not meaningful)
+};
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+static ImGuiContext* CreateContext()
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2((float)FB_WIDTH, (float)FB_HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    return ctx;
+}
+
+static void RenderFrame(void (*scene_func)(), ImVector<ImU32>& fb, double* out_render_ms)
+{
+    ImGui_ImplSoftRaster_NewFrame();
+    ImGui::NewFrame();
+    scene_func();
+    ImGui::Render();
+    ClearFramebuffer(fb);
+    const double t0 = GetTimeMs();
+    ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), fb.Data, FB_WIDTH, FB_HEIGHT, FB_WIDTH * (int)sizeof(ImU32));
+    if (out_render_ms)
+        *out_render_ms = GetTimeMs() - t0;
+}
+
+static int RunBenchmark(int frames)
+{
+    static const BenchScene scenes[] =
+    {
+        { "fill_32_layers", ShowBenchSceneFill, 32 },
+        { "text", ShowBenchSceneText, 0 },
+        { "shapes", ShowBenchSceneShapes, 0 },
+        { "demo", ShowBenchSceneDemo, 0 },
+    };
+    int max_threads = (int)std::thread::hardware_concurrency();
+    if (max_threads < 1)
+        max_threads = 1;
+
+    ImVector<ImU32> fb;
+    fb.resize(FB_WIDTH * FB_HEIGHT);
+    printf("Software rasterizer benchmark: %dx%d, %d frames per scene\n", FB_WIDTH, FB_HEIGHT, frames);
+    printf("%-16s %8s %12s %12s\n", "scene", "threads", "ms/frame", "Mpixels/s");
+    for (const BenchScene& scene : scenes)
+    {
+        for (int threads = 1; ; threads = (threads * 2 > max_threads && threads < max_threads) ? max_threads : threads * 2)
+        {
+            ImGuiContext* ctx = CreateContext();
+            ImGui_ImplSoftRaster_Init(threads);
+            RenderFrame(scene.Func, fb, nullptr); // Warm-up
+            double total_ms = 0.0;
+            for (int frame = 0; frame < frames; frame++)
+            {
+                double render_ms = 0.0;
+                RenderFrame(scene.Func, fb, &render_ms);
+                total_ms += render_ms;
+            }
+            ImGui_ImplSoftRaster_Shutdown();
+            ImGui::DestroyContext(ctx);
+
+            const double ms_per_frame = total_ms / frames;
+            if (scene.LayersCount > 0)
+                printf("%-16s %8d %12.3f %12.1f\n", scene.Name, threads, ms_per_frame, (double)scene.LayersCount * FB_WIDTH * FB_HEIGHT / (ms_per_frame * 1000.0));
+            else
+                printf("%-16s %8d %12.3f %12s\n", scene.Name, threads, ms_per_frame, "-");
+            if (threads >= max_threads)
+                break;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int threads = 0;
+    int frames = 60;
+    int tolerance = 0;
+    bool bench = false;
+    const char* out_filename = nullptr;
+    const char* compare_filename = nullptr;
+    const char* diff_filename = nullptr;
+    for (int n = 1; n < argc; n++)
+    {
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(argv[n], "--threads") == 0 && has_value)         { threads = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--frames") == 0 && has_value)     { frames = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--out") == 0 && has_value)        { out_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--compare") == 0 && has_value)    { compare_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--tolerance") == 0 && has_value)  { tolerance = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--diff") == 0 && has_value)       { diff_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--bench") == 0)                   { bench = true; }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--threads N] [--out FILE] [--compare FILE] [--tolerance N] [--diff FILE] [--bench] [--frames N]\n", argv[0]);
+            return 2;
+        }
+    }
+    IMGUI_CHECKVERSION();
+    if (bench)
+        return RunBenchmark(frames > 0 ? frames : 1);
+
+    // Render a few frames of the test scene so that windows have settled their layout
+    ImGuiContext* ctx = CreateContext();
+    ImGui_ImplSoftRaster_Init(threads);
+    ImVector<ImU32> fb;
+    fb.resize(FB_WIDTH * FB_HEIGHT);
+    for (int n = 0; n < 3; n++)
+        RenderFrame(ShowTestScene, fb, nullptr);
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext(ctx);
+    printf("Rendered %dx%d test scene.\n", FB_WIDTH, FB_HEIGHT);
+
+    int ret = 0;
+    if (out_filename)
+    {
+        if (!WriteTGA(out_filename, fb.Data, FB_WIDTH, FB_HEIGHT))
+        {
+            fprintf(stderr, "Error: could not write '%s'\n", out_filename);
+            return 2;
+        }
+        printf("Wrote '%s'.\n", out_filename);
+    }
+    if (compare_filename)
+    {
+        ImVector<ImU32> ref;
+        int ref_width = 0, ref_height = 0;
+        if (!ReadTGA(compare_filename, ref, &ref_width, &ref_height))
+        {
+            fprintf(stderr, "Error: could not read '%s'\n", compare_filename);
+            return 2;
+        }
+        if (ref_width != FB_WIDTH || ref_height != FB_HEIGHT)
+        {
+            fprintf(stderr, "Error: reference image is %dx%d, expected %dx%d\n", ref_width, ref_height, FB_WIDTH, FB_HEIGHT);
+            return 1;
+        }
+
+        // Count pixels where any channel differs by more than the tolerance
+        int diff_count = 0;
+        int diff_max = 0;
+        ImVector<ImU32> diff;
+        diff.resize(fb.Size);
+        for (int n = 0; n < fb.Size; n++)
+        {
+            int pixel_diff = 0;
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                const int d = abs((int)((fb[n] >> shift) & 0xFF) - (int)((ref[n] >> shift) & 0xFF));
+                pixel_diff = (d > pixel_diff) ? d : pixel_diff;
+            }
+            diff_max = (pixel_diff > diff_max) ? pixel_diff : diff_max;
+            if (pixel_diff > tolerance)
+                diff_count++;
+            diff[n] = (pixel_diff > tolerance) ? IM_COL32(255, 0, 0, 255) : IM_COL32(pixel_diff * 255 / (tolerance + 1), pixel_diff * 255 / (tolerance + 1), pixel_diff * 255 / (tolerance + 1), 255);
+        }
+        printf("Compared to '%s': %d pixel(s) differ by more than %d (max difference: %d).\n", compare_filename, diff_count, tolerance, diff_max);
+        if (diff_filename && WriteTGA(diff_filename, diff.Data, FB_WIDTH, FB_HEIGHT))
+            printf("Wrote '%s'.\n", diff_filename);
+        if (diff_count > 0)
+            ret = 1;
+    }
+    return ret;
+}
@@ -0,0 +1,293 @@
+// dear imgui: "null" example application running many contexts from multiple threads
+// (compile and link imgui with IMGUI_USE_THREAD_LOCAL_CONTEXT, run headless with simulated inputs, render in memory with imgui_impl_softraster)
+// This is used to check that independent contexts can run concurrently, e.g. one context per client session on a server.
+//
+// Usage: example_null_threads [options]
+//   --contexts N        Number of contexts (default: 64)
+//   --threads N         Number of threads in the pool (default: number of hardware threads)
+//   --frames N          Number of frames to run for each context (default: 60)
+//
+// Notes:
+// - Every context is first run alone on the main thread to compute a reference checksum of its draw data and rendered pixels.
+//   Contexts are then created and run again on a pool of threads, each frame may run on a different thread.
+//   Exit code is 1 when any checksum differs, which would mean that contexts are sharing mutable state.
+// - Each context has its own renderer backend (imgui_impl_softraster, rasterizing on the calling thread) and renders into
+//   a framebuffer owned by the calling thread.
+// - Contexts are run twice on the pool of threads: first with their own font atlas, built from the thread which created
+//   the context, then all sharing a single font atlas built once on the main thread and made read-only with SetImmutable().
+//   The owner of the shared atlas creates its texture and sets its TexID before SetImmutable(): renderer backends don't
+//   touch the TexID of an immutable atlas. The shared atlas and its texture must outlive all the contexts using it.
+// - Each thread sets its current context with ImGui::SetCurrentContext(), which only affects the calling thread.
+// - Don't call ImGui::ShowDemoWindow() from multiple threads: the demo code stores its state in static variables.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#ifndef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#error "This example requires IMGUI_USE_THREAD_LOCAL_CONTEXT to be defined (see Makefile)."
+#endif
+
+static const int FB_WIDTH = 1280;
+static const int FB_HEIGHT = 720;
+
+// Per-session state: must not be stored in static variables as sessions run concurrently
+struct Session
+{
+    int                 Index;
+    ImGuiContext*       Ctx;
+    std::atomic<int>    FramesDone;
+    ImU32               Checksum;
+    char                Text[64];
+    float               Values[100];
+    float               Slider;
+    bool                Checkbox;
+};
+
+static ImU32 HashBytes(const void* data, size_t size, ImU32 seed)
+{
+    // FNV-1a
+    const unsigned char* p = (const unsigned char*)data;
+    ImU32 hash = seed ^ 2166136261u;
+    while (size-- > 0)
+        hash = (hash ^ *p++) * 16777619u;
+    return hash;
+}
+
+static void SessionCreate(Session* s, int index, ImFontAtlas* shared_font_atlas)
+{
+    s->Index = index;
+    s->FramesDone = 0;
+    s->Checksum = 0;
+    snprintf(s->Text, sizeof(s->Text), "Hello from session %d", index);
+    for (int n = 0; n < IM_ARRAYSIZE(s->Values); n++)
+        s->Values[n] = (float)((n * 7 + index * 13) % 100) * 0.01f;
+    s->Slider = 0.0f;
+    s->Checkbox = false;
+
+    s->Ctx = ImGui::CreateContext(shared_font_atlas);
+    ImGui::SetCurrentContext(s->Ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+    io.DisplaySize = ImVec2((float)FB_WIDTH, (float)FB_HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui_ImplSoftRaster_Init(1); // Sessions already run in parallel: rasterize on the calling thread
+
+    // Build atlas (a shared immutable atlas is already built: this only retrieves its pixels)
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    s->Checksum = HashBytes(tex_pixels, (size_t)(tex_w * tex_h * 4), s->Checksum);
+}
+
+static void SessionDestroy(Session* s)
+{
+    ImGui::SetCurrentContext(s->Ctx);
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext(s->Ctx);
+    s->Ctx = nullptr;
+}
+
+static void SessionFrame(Session* s, int frame, int frames_count)
+{
+    ImGui::SetCurrentContext(s->Ctx);
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Simulated inputs: move the mouse over the window, click every 10 frames, type some text
+    const float t = (float)((frame * 17 + s->Index * 31) % 400);
+    io.AddMousePosEvent(20.0f + t, 40.0f + t * 0.5f);
+    io.AddMouseButtonEvent(0, (frame % 10) == 5);
+    if ((frame % 20) == 0)
+        io.AddInputCharacter((unsigned int)('a' + (frame / 20 + s->Index) % 26));
+
+    ImGui_ImplSoftRaster_NewFrame();
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+    ImGui::SetNextWindowSize(ImVec2(600.0f, 680.0f));
+    ImGui::Begin("Session");
+    ImGui::Text("Frame %d, session %d", frame, s->Index);
+    ImGui::InputText("Text", s->Text, IM_ARRAYSIZE(s->Text));
+    ImGui::SliderFloat("Slider", &s->Slider, 0.0f, 1.0f);
+    ImGui::Checkbox("Checkbox", &s->Checkbox);
+    ImGui::PlotLines("Values", s->Values, IM_ARRAYSIZE(s->Values), frame % IM_ARRAYSIZE(s->Values), nullptr, 0.0f, 1.0f, ImVec2(0.0f, 60.0f));
+    if (ImGui::TreeNodeEx("Tree", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        for (int n = 0; n < 10; n++)
+            ImGui::BulletText("Item %d", n + s->Index);
+        ImGui::TreePop();
+    }
+    if (ImGui::BeginTable("Table", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY, ImVec2(0.0f, 200.0f)))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        for (int column = 0; column < 4; column++)
+            ImGui::TableSetupColumn("Column");
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 100; row++)
+            for (int column = 0; column < 4; column++)
+            {
+                ImGui::TableNextColumn();
+                ImGui::Text("%d,%d", row, column);
+            }
+        ImGui::EndTable();
+    }
+    for (int n = 0; n < 20; n++)
+    {
+        ImGui::PushID(n);
+        if (ImGui::Button("Button"))
+            s->Values[n] = 1.0f - s->Values[n];
+        ImGui::PopID();
+        if ((n % 5) != 4)
+            ImGui::SameLine();
+    }
+    ImGui::End();
+    if ((frame % 30) < 15)
+        ImGui::SetTooltip("Tooltip %d", s->Index);
+    ImGui::Render();
+
+    // Accumulate checksum of draw data
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        s->Checksum = HashBytes(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), s->Checksum);
+        s->Checksum = HashBytes(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), s->Checksum);
+    }
+
+    // Render into a framebuffer owned by the calling thread, accumulate checksum of the pixels of the last frame
+    static thread_local std::vector<ImU32> framebuffer;
+    framebuffer.assign(FB_WIDTH * FB_HEIGHT, IM_COL32(0, 0, 0, 255));
+    ImGui_ImplSoftRaster_RenderDrawData(draw_data, framebuffer.data(), FB_WIDTH, FB_HEIGHT, FB_WIDTH * (int)sizeof(ImU32));
+    if (frame == frames_count - 1)
+        s->Checksum = HashBytes(framebuffer.data(), framebuffer.size() * sizeof(ImU32), s->Checksum);
+}
+
+static double GetElapsedMs(std::chrono::high_resolution_clock::time_point t0)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - t0).count();
+}
+
+// Create and run all contexts from a pool of threads, return the number of checksums which differ from the reference.
+// Jobs are taken in (frame, session) order. A job waits for the previous frame of its session, which was taken earlier
+// by another thread, so sessions keep moving between threads but always run their frames in order.
+static int RunThreaded(const char* name, std::vector<Session>& sessions, const std::vector<ImU32>& reference_checksums, int threads_count, int frames_count, ImFontAtlas* shared_font_atlas)
+{
+    const int contexts_count = (int)sessions.size();
+    std::atomic<int> next_create(0);
+    std::atomic<int> next_job(0);
+    std::atomic<int> created_count(0);
+    const int jobs_count = contexts_count * frames_count;
+    std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+    auto worker_func = [&]()
+    {
+        for (int session_n = next_create++; session_n < contexts_count; session_n = next_create++)
+        {
+            SessionCreate(&sessions[session_n], session_n, shared_font_atlas);
+            created_count++;
+        }
+        while (created_count.load() < contexts_count)
+            std::this_thread::yield();
+        for (int job_n = next_job++; job_n < jobs_count; job_n = next_job++)
+        {
+            Session* s = &sessions[job_n % contexts_count];
+            const int frame = job_n / contexts_count;
+            while (s->FramesDone.load() != frame)
+                std::this_thread::yield();
+            SessionFrame(s, frame, frames_count);
+            s->FramesDone++;
+        }
+        ImGui::SetCurrentContext(nullptr);
+    };
+    std::vector<std::thread> threads;
+    for (int thread_n = 1; thread_n < threads_count; thread_n++)
+        threads.push_back(std::thread(worker_func));
+    worker_func();
+    for (std::thread& thread : threads)
+        thread.join();
+    printf("%-13s %.1f ms\n", name, GetElapsedMs(t0));
+
+    int mismatches_count = 0;
+    for (int session_n = 0; session_n < contexts_count; session_n++)
+    {
+        Session* s = &sessions[session_n];
+        if (s->Checksum != reference_checksums[session_n])
+        {
+            printf("Context %d: checksum %08X, expected %08X\n", session_n, s->Checksum, reference_checksums[session_n]);
+            mismatches_count++;
+        }
+        SessionDestroy(s);
+    }
+    return mismatches_count;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+
+    int contexts_count = 64;
+    int threads_count = (int)std::thread::hardware_concurrency();
+    int frames_count = 60;
+    for (int n = 1; n < argc; n++)
+    {
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(argv[n], "--contexts") == 0 && has_value)        { contexts_count = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--threads") == 0 && has_value)    { threads_count = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--frames") == 0 && has_value)     { frames_count = atoi(argv[++n]); }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--contexts N] [--threads N] [--frames N]\n", argv[0]);
+            return 1;
+        }
+    }
+    contexts_count = (contexts_count < 1) ? 1 : contexts_count;
+    threads_count = (threads_count < 1) ? 1 : threads_count;
+    frames_count = (frames_count < 1) ? 1 : frames_count;
+    printf("Dear ImGui %s: %d contexts, %d threads, %d frames\n", IMGUI_VERSION, contexts_count, threads_count, frames_count);
+
+    // Reference: run each context alone on the main thread
+    std::vector<Session> sessions(contexts_count);
+    std::vector<ImU32> reference_checksums(contexts_count);
+    std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+    for (int session_n = 0; session_n < contexts_count; session_n++)
+    {
+        Session* s = &sessions[session_n];
+        SessionCreate(s, session_n, nullptr);
+        for (int frame = 0; frame < frames_count; frame++)
+            SessionFrame(s, frame, frames_count);
+        reference_checksums[session_n] = s->Checksum;
+        SessionDestroy(s);
+    }
+    printf("%-13s %.1f ms\n", "Sequential:", GetElapsedMs(t0));
+
+    // Run again from a pool of threads, each context owning its font atlas
+    int mismatches_count = RunThreaded("Threaded:", sessions, reference_checksums, threads_count, frames_count, nullptr);
+
+    // Run again from a pool of threads, all contexts sharing a single immutable font atlas.
+    // The atlas needs to be fully built and have its TexID set before calling SetImmutable(): create its texture once here,
+    // in the IM_COL32() layout expected by imgui_impl_softraster.
+    ImFontAtlas* shared_font_atlas = IM_NEW(ImFontAtlas)();
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    shared_font_atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    std::vector<ImU32> shared_font_pixels((size_t)(tex_w * tex_h));
+    for (int n = 0; n < tex_w * tex_h; n++)
+        shared_font_pixels[n] = IM_COL32(tex_pixels[n * 4 + 0], tex_pixels[n * 4 + 1], tex_pixels[n * 4 + 2], tex_pixels[n * 4 + 3]);
+    ImGui_ImplSoftRaster_Texture shared_font_texture = { shared_font_pixels.data(), tex_w, tex_h };
+    shared_font_atlas->SetTexID((ImTextureID)&shared_font_texture);
+    shared_font_atlas->SetImmutable();
+    mismatches_count += RunThreaded("Shared atlas:", sessions, reference_checksums, threads_count, frames_count, shared_font_atlas);
+    IM_DELETE(shared_font_atlas);
+
+    if (mismatches_count > 0)
+    {
+        printf("%d context(s) out of %d produced different draw data or pixels when running concurrently\n", mismatches_count, contexts_count);
+        return 1;
+    }
+    printf("All %d contexts produced the same draw data and pixels\n", contexts_count);
+    return 0;
+}
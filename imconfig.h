@@ -49,6 +49,11 @@
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
 
+//---- Use thread local storage for the current context pointer (GImGui), so N threads can each use their own context without calling SetCurrentContext() every frame.
+// CreateContext()/SetCurrentContext() then only affect the calling thread. Not compatible with building Dear ImGui as a DLL on Windows (thread_local variables can't be exported).
+// Dear ImGui doesn't have other mutable static state, but the demo window does: don't call ShowDemoWindow() from multiple threads.
+//#define IMGUI_USE_THREAD_LOCAL_CONTEXT
+
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
 
@@ -106,6 +111,15 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert layout (instead of 20 bytes) to reduce vertex upload bandwidth.
+// Positions are stored as 16-bit signed fixed-point with IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS fractional bits (default 3 = 1/8th pixel precision, +/-4096 pixels range),
+// LIMIT: positions beyond the range (+/-32768 >> IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS pixels) are clamped. We assert that io.DisplaySize and clip rectangles fit in it,
+// so use e.g. 2 fractional bits (+/-8192 pixels) for larger displays. Geometry extending past the range outside of the clip rectangle may still be distorted.
+// UV are stored as 16-bit unsigned normalized values (0.0f..1.0f range: UV outside of that range will be clamped, so don't use it for tiled images).
+// Your renderer backend will need to support it and set ImGuiBackendFlags_RendererHasCompactVtx (OpenGL3, Vulkan, SDL_Renderer2/3 and SoftRaster backends do).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS 3
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -120,6 +134,14 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Attribute allocations to call sites (ImDrawList, ImGuiStorage, Tables etc.), displayed in 'Metrics->Memory allocations'.
+// Adds a small overhead to every allocation and to instrumented functions. Compiled out entirely when not defined.
+//#define IMGUI_DEBUG_ALLOC_SITES
+
+//---- Debug Tools: Enable frame profiler: zones (NewFrame, inputs, navigation, each window Begin/End, tables layout, Render...) timed with a high resolution timer,
+// displayed in 'Metrics->Profiler'. See IMGUI_PROFILE_SCOPE() and ProfilerSetHook() in imgui_internal.h to add your own zones or forward them to an external profiler.
+//#define IMGUI_ENABLE_PROFILER
+
 //---- Tip: You can add extra functions within the ImGui:: namespace from anywhere (e.g. your own sources/header files)
 /*
 namespace ImGui
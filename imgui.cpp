@@ -67,7 +67,7 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImFrameArena
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -86,6 +86,7 @@ CODE
 // [SECTION] LOCALIZATION
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] FRAME PROFILER
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
@@ -367,7 +368,7 @@ CODE
     void MyImGuiRenderFunction(ImDrawData* draw_data)
     {
        // TODO: Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled
-       // TODO: Setup texture sampling state: sample with bilinear filtering (NOT point/nearest filtering). Use 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines;' to allow point/nearest filtering.
+       // TODO: Setup texture sampling state: sample with bilinear filtering (NOT point/nearest filtering). Use 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners;' to allow point/nearest filtering.
        // TODO: Setup viewport covering draw_data->DisplayPos to draw_data->DisplayPos + draw_data->DisplaySize
        // TODO: Setup orthographic projection matrix cover draw_data->DisplayPos to draw_data->DisplayPos + draw_data->DisplaySize
        // TODO: Setup shader: vertex { float2 pos, float2 uv, u32 color }, fragment shader sample color from 1 texture, multiply by vertex color.
@@ -991,6 +992,16 @@ CODE
 #include <TargetConditionals.h>
 #endif
 
+// Monotonic timer (ImGetTimeNs(), used by input latency statistics and frame profiler)
+#if !(defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS))
+#include <time.h>           // clock_gettime
+#endif
+
+// [Visual Studio] Atomics intrinsics
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>         // _InterlockedExchangeAdd
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -1040,6 +1051,7 @@ CODE
 // When using CTRL+TAB (or Gamepad Square+L/R) we delay the visual a little in order to reduce visual noise doing a fast switch.
 static const float NAV_WINDOWING_HIGHLIGHT_DELAY            = 0.20f;    // Time before the highlight and screen dimming starts fading in
 static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time before the window list starts to appear
+static const int   NAV_ITEM_INDEX_MIN_ITEMS                 = 1000;     // Minimum number of navigable items in a window for them to be retained and indexed for directional navigation (see NavMoveRequestResolveWithItemIndex())
 
 // Window resizing from edges (when io.ConfigWindowsResizeFromEdges = true and ImGuiBackendFlags_HasMouseCursors is set in io.BackendFlags by backend)
 static const float WINDOWS_HOVER_PADDING                    = 4.0f;     // Extend outside window for hovering/resizing (maxxed with TouchPadding) and inside windows for borders. Affect FindHoveredWindow().
@@ -1049,6 +1061,9 @@ static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 0.70f;    // Lock
 // Tooltip offset
 static const ImVec2 TOOLTIP_DEFAULT_OFFSET = ImVec2(16, 10);            // Multiplied by g.Style.MouseCursorScale
 
+// Garbage collection (when io.ConfigMemoryCompactBudget != 0)
+static const int   GC_BUDGET_MAX_COMPACT_PER_FRAME          = 8;        // Maximum number of windows/tables/tab bars compacted per frame while over budget, so freeing a large amount of memory is spread over multiple frames
+
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
 //-------------------------------------------------------------------------
@@ -1066,6 +1081,8 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, const char* data, size_t data_size);
+static void             WindowSettingsHandler_WriteBinary(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data_ctx);
@@ -1086,9 +1103,14 @@ static inline void      NavUpdateAnyRequestFlag();
 static void             NavUpdateCreateWrappingRequest();
 static void             NavEndFrame();
 static bool             NavScoreItem(ImGuiNavItemData* result);
+static bool             NavScoreItemEx(ImGuiNavItemData* result, ImGuiWindow* window, const ImRect& cand, ImGuiID cand_id);
 static void             NavApplyItemToResult(ImGuiNavItemData* result);
 static void             NavProcessItem();
 static void             NavProcessItemForTabbingRequest(ImGuiID id, ImGuiItemFlags item_flags, ImGuiNavMoveFlags move_flags);
+static void             NavItemIndexNewFrame(ImGuiWindow* window);
+static void             NavItemIndexAddItem(ImGuiWindow* window);
+static void             NavItemIndexScore(ImGuiWindow* window, ImGuiNavItemData* result, bool visible_only);
+static bool             NavMoveRequestResolveWithItemIndex();
 static ImVec2           NavCalcPreferredRefPos();
 static void             NavSaveLastChildNavWindowIntoParent(ImGuiWindow* nav_window);
 static ImGuiWindow*     NavRestoreLastChildNavWindow(ImGuiWindow* window);
@@ -1109,6 +1131,7 @@ static void             UpdateKeyRoutingTable(ImGuiKeyRoutingTable* rt);
 
 // Misc
 static void             UpdateSettings();
+static void             GcUpdateMemoryBudget();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1137,7 +1160,9 @@ static void             UpdateViewportsNewFrame();
 //   Change to a different context by calling ImGui::SetCurrentContext().
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
-//   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
+//   - '#define IMGUI_USE_THREAD_LOCAL_CONTEXT' in your imconfig.h to make this variable thread local.
+//     Each context may then be used from any thread, as long as a single thread uses it at a time.
+//   - Or change this variable to use your own thread local storage, in your imconfig.h:
 //         struct ImGuiContext;
 //         extern thread_local ImGuiContext* MyImGuiTLS;
 //         #define GImGui MyImGuiTLS
@@ -1146,11 +1171,16 @@ static void             UpdateViewportsNewFrame();
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext* GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // - You probably don't want to modify that mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
+// - Those are shared by all contexts and threads: set them before creating contexts, and make sure they are thread-safe if you use contexts from multiple threads.
 // - DLL users: read comments above.
 #ifndef IMGUI_DISABLE_DEFAULT_ALLOCATORS
 static void*   MallocWrapper(size_t size, void* user_data)    { IM_UNUSED(user_data); return malloc(size); }
@@ -1212,6 +1242,7 @@ ImGuiStyle::ImGuiStyle()
     AntiAliasedLines        = true;             // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU.
     AntiAliasedLinesUseTex  = true;             // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     AntiAliasedFill         = true;             // Enable anti-aliased filled shapes (rounded rectangles, circles, etc.).
+    AntiAliasedFillUseTex   = false;            // Enable anti-aliased circles, circle outlines and filled rounded rectangles using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Opt-in: output differs slightly from tessellated shapes.
     CurveTessellationTol    = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     CircleTessellationMaxError = 0.30f;         // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
 
@@ -1269,7 +1300,9 @@ ImGuiIO::ImGuiIO()
     DeltaTime = 1.0f / 60.0f;
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini"; // Important: "imgui.ini" is relative to current working dir, most apps will want to lock this to an absolute path (e.g. same path as executables).
+    IniSavingBinary = false;
     LogFilename = "imgui_log.txt";
+    LogFlushThreshold = 64 * 1024;
 #ifndef IMGUI_DISABLE_OBSOLETE_KEYIO
     for (int i = 0; i < ImGuiKey_COUNT; i++)
         KeyMap[i] = -1;
@@ -1296,12 +1329,16 @@ ImGuiIO::ImGuiIO()
     ConfigMacOSXBehaviors = false;
 #endif
     ConfigInputTrickleEventQueue = true;
+    ConfigInputCoalesceEvents = true;
     ConfigInputTextCursorBlink = true;
     ConfigInputTextEnterKeepActive = false;
     ConfigDragClickToInputText = false;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
+    ConfigDrawListCurveCache = false;
+    ConfigDrawDataMerge = false;
     ConfigDebugBeginReturnValueOnce = false;
     ConfigDebugBeginReturnValueLoop = false;
 
@@ -1337,6 +1374,7 @@ void ImGuiIO::AddInputCharacter(unsigned int c)
     e.Type = ImGuiInputEventType_Text;
     e.Source = ImGuiInputSource_Keyboard;
     e.EventId = g.InputEventsNextEventId++;
+    e.TimeNs = ImGetTimeNs();
     e.Text.Char = c;
     g.InputEventsQueue.push_back(e);
 }
@@ -1397,6 +1435,24 @@ void ImGuiIO::ClearEventsQueue()
     g.InputEventsQueue.clear();
 }
 
+// Merge a new mouse event into the last queued event when it has the same type and mouse source.
+// Button/key/text/focus events are never merged, and since we only ever look at the last event, their order relative to mouse events is preserved.
+static ImGuiInputEvent* FindCoalescableMouseEvent(ImGuiContext* ctx, ImGuiInputEventType type)
+{
+    ImGuiContext& g = *ctx;
+    if (!g.IO.ConfigInputCoalesceEvents || g.InputEventsQueue.Size == 0)
+        return NULL;
+    ImGuiInputEvent* e = &g.InputEventsQueue.back();
+    if (e->Type != type || e->AddedByTestEngine)
+        return NULL;
+    const ImGuiMouseSource source = (type == ImGuiInputEventType_MousePos) ? e->MousePos.MouseSource : e->MouseWheel.MouseSource;
+    if (source != g.InputEventsNextMouseSource)
+        return NULL;
+    g.InputEventsStats.CoalescedCountPending++;
+    g.InputEventsStats.CoalescedCountTotal++;
+    return e;
+}
+
 // Clear current keyboard/mouse/gamepad state + current frame text input buffer. Equivalent to releasing all keys/buttons.
 void ImGuiIO::ClearInputKeys()
 {
@@ -1488,6 +1544,7 @@ void ImGuiIO::AddKeyAnalogEvent(ImGuiKey key, bool down, float analog_value)
     e.Type = ImGuiInputEventType_Key;
     e.Source = ImGui::IsGamepadKey(key) ? ImGuiInputSource_Gamepad : ImGuiInputSource_Keyboard;
     e.EventId = g.InputEventsNextEventId++;
+    e.TimeNs = ImGetTimeNs();
     e.Key.Key = key;
     e.Key.Down = down;
     e.Key.AnalogValue = analog_value;
@@ -1549,10 +1606,19 @@ void ImGuiIO::AddMousePosEvent(float x, float y)
     if (latest_pos.x == pos.x && latest_pos.y == pos.y)
         return;
 
+    // Coalesce with previous event (keep its EventId and Time, so latency accounts for the oldest merged event)
+    if (ImGuiInputEvent* prev_event = FindCoalescableMouseEvent(&g, ImGuiInputEventType_MousePos))
+    {
+        prev_event->MousePos.PosX = pos.x;
+        prev_event->MousePos.PosY = pos.y;
+        return;
+    }
+
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MousePos;
     e.Source = ImGuiInputSource_Mouse;
     e.EventId = g.InputEventsNextEventId++;
+    e.TimeNs = ImGetTimeNs();
     e.MousePos.PosX = pos.x;
     e.MousePos.PosY = pos.y;
     e.MousePos.MouseSource = g.InputEventsNextMouseSource;
@@ -1577,6 +1643,7 @@ void ImGuiIO::AddMouseButtonEvent(int mouse_button, bool down)
     e.Type = ImGuiInputEventType_MouseButton;
     e.Source = ImGuiInputSource_Mouse;
     e.EventId = g.InputEventsNextEventId++;
+    e.TimeNs = ImGetTimeNs();
     e.MouseButton.Button = mouse_button;
     e.MouseButton.Down = down;
     e.MouseButton.MouseSource = g.InputEventsNextMouseSource;
@@ -1593,10 +1660,19 @@ void ImGuiIO::AddMouseWheelEvent(float wheel_x, float wheel_y)
     if (!AppAcceptingEvents || (wheel_x == 0.0f && wheel_y == 0.0f))
         return;
 
+    // Coalesce with previous event (wheel values are relative so they are accumulated)
+    if (ImGuiInputEvent* prev_event = FindCoalescableMouseEvent(&g, ImGuiInputEventType_MouseWheel))
+    {
+        prev_event->MouseWheel.WheelX += wheel_x;
+        prev_event->MouseWheel.WheelY += wheel_y;
+        return;
+    }
+
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_MouseWheel;
     e.Source = ImGuiInputSource_Mouse;
     e.EventId = g.InputEventsNextEventId++;
+    e.TimeNs = ImGetTimeNs();
     e.MouseWheel.WheelX = wheel_x;
     e.MouseWheel.WheelY = wheel_y;
     e.MouseWheel.MouseSource = g.InputEventsNextMouseSource;
@@ -1626,6 +1702,7 @@ void ImGuiIO::AddFocusEvent(bool focused)
     ImGuiInputEvent e;
     e.Type = ImGuiInputEventType_Focus;
     e.EventId = g.InputEventsNextEventId++;
+    e.TimeNs = ImGetTimeNs();
     e.AppFocused.Focused = focused;
     g.InputEventsQueue.push_back(e);
 }
@@ -2039,6 +2116,35 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+// Used for reference counts which may be updated from multiple threads (e.g. ImFontAtlas shared between contexts).
+int ImAtomicAdd(int* p, int v)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return (int)_InterlockedExchangeAdd((volatile long*)p, (long)v) + v;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __atomic_add_fetch(p, v, __ATOMIC_ACQ_REL);
+#else
+    return *p += v; // FIXME: Not atomic with this compiler, don't share an ImFontAtlas between contexts used from different threads.
+#endif
+}
+
+// Monotonic clock, independent from io.DeltaTime. Return 0 when no timer is available on this platform.
+ImU64 ImGetTimeNs()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    LARGE_INTEGER counter, freq;
+    ::QueryPerformanceCounter(&counter);
+    ::QueryPerformanceFrequency(&freq);
+    return (ImU64)((double)counter.QuadPart * 1000000000.0 / (double)freq.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -2465,6 +2571,7 @@ void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImGuiStorage");
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2478,6 +2585,7 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImGuiStorage");
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2486,6 +2594,7 @@ float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImGuiStorage");
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
@@ -2495,6 +2604,7 @@ void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImGuiStorage");
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
@@ -2509,6 +2619,7 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImGuiStorage");
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
@@ -2518,6 +2629,7 @@ void ImGuiStorage::SetFloat(ImGuiID key, float val)
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImGuiStorage");
     ImGuiStoragePair* it = LowerBound(Data, key);
     if (it == Data.end() || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
@@ -2531,6 +2643,52 @@ void ImGuiStorage::SetAllInt(int v)
         Data[i].val_i = v;
 }
 
+// Helper: ImChunkStreamIndex (linear probing, load factor <= 50%)
+static inline int ImChunkStreamIndexHash(ImGuiID key)
+{
+    const ImU32 h = key * 2654435761u;
+    return (int)(h ^ (h >> 16));
+}
+
+int ImChunkStreamIndex::GetOffset(ImGuiID key) const
+{
+    if (Count == 0 || key == 0)
+        return -1;
+    const int mask = Keys.Size - 1;
+    for (int idx = ImChunkStreamIndexHash(key) & mask; Keys.Data[idx] != 0; idx = (idx + 1) & mask)
+        if (Keys.Data[idx] == key)
+            return Offsets.Data[idx];
+    return -1;
+}
+
+void ImChunkStreamIndex::SetOffset(ImGuiID key, int offset)
+{
+    IM_ASSERT(key != 0);
+    if ((Count + 1) * 2 > Keys.Size)
+    {
+        ImVector<ImGuiID> old_keys;
+        ImVector<int> old_offsets;
+        old_keys.swap(Keys);
+        old_offsets.swap(Offsets);
+        Keys.resize(ImMax(64, old_keys.Size * 2), 0);
+        Offsets.resize(Keys.Size);
+        Count = 0;
+        for (int n = 0; n < old_keys.Size; n++)
+            if (old_keys.Data[n] != 0)
+                SetOffset(old_keys.Data[n], old_offsets.Data[n]);
+    }
+    const int mask = Keys.Size - 1;
+    int idx = ImChunkStreamIndexHash(key) & mask;
+    while (Keys.Data[idx] != 0 && Keys.Data[idx] != key)
+        idx = (idx + 1) & mask;
+    if (Keys.Data[idx] == 0)
+    {
+        Keys.Data[idx] = key;
+        Count++;
+    }
+    Offsets.Data[idx] = offset;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextFilter
 //-----------------------------------------------------------------------------
@@ -2629,7 +2787,7 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 }
 
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImFrameArena
 //-----------------------------------------------------------------------------
 
 // On some platform vsnprintf() takes va_list by reference and modifies it.
@@ -2646,6 +2804,7 @@ char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImGuiTextBuffer");
     int len = str_end ? (int)(str_end - str) : (int)strlen(str);
 
     // Add zero-terminator the first time
@@ -2673,6 +2832,7 @@ void ImGuiTextBuffer::appendf(const char* fmt, ...)
 // Helper: Text buffer for logging/accumulating text
 void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImGuiTextBuffer");
     va_list args_copy;
     va_copy(args_copy, args);
 
@@ -2711,6 +2871,51 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     EndOffset = ImMax(EndOffset, new_size);
 }
 
+void* ImFrameArena::Alloc(size_t sz)
+{
+    // Sizes are stored as int: also leave room for the sum of allocations and for merging blocks on Reset()
+    IM_ASSERT(sz <= (size_t)(INT_MAX / 4) && (size_t)UsedBytes + sz <= (size_t)(INT_MAX / 4) && "Allocation too large for ImFrameArena!");
+    const int size = (int)IM_MEMALIGN(sz, 16);
+    if (Blocks.Size == 0 || CurrOff + size > BlocksSize.back())
+    {
+        const int block_size = ImMax(ImMax(size, UsedBytes), 4096);
+        Blocks.push_back((char*)IM_ALLOC((size_t)block_size));
+        BlocksSize.push_back(block_size);
+        CurrOff = 0;
+    }
+    void* ptr = Blocks.back() + CurrOff;
+    CurrOff += size;
+    UsedBytes += size;
+    return ptr;
+}
+
+void ImFrameArena::Reset()
+{
+    if (GetCapacityInBytes() > IM_FRAMEARENA_MAX_RETAINED_SIZE)
+        ClearFreeMemory();
+    else if (Blocks.Size > 1)
+    {
+        // Merge blocks into one large enough for everything allocated during this frame
+        const int block_size = GetCapacityInBytes();
+        for (char* block : Blocks)
+            IM_FREE(block);
+        Blocks.resize(1);
+        BlocksSize.resize(1);
+        Blocks[0] = (char*)IM_ALLOC((size_t)block_size);
+        BlocksSize[0] = block_size;
+    }
+    CurrOff = UsedBytes = 0;
+}
+
+void ImFrameArena::ClearFreeMemory()
+{
+    for (char* block : Blocks)
+        IM_FREE(block);
+    Blocks.clear();
+    BlocksSize.clear();
+    CurrOff = UsedBytes = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -2855,6 +3060,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
     ItemsCount = items_count;
+    window->NavItemIndex.IsIncomplete = true; // Clipped items are not submitted, the navigation item index can't be used to resolve move requests.
     DisplayStart = -1;
     DisplayEnd = 0;
 
@@ -3608,6 +3814,10 @@ void ImGui::Initialize()
     ImGuiContext& g = *GImGui;
     IM_ASSERT(!g.Initialized && !g.SettingsLoaded);
 
+    // Reference shared font atlas, released in Shutdown()
+    if (!g.FontAtlasOwnedByContext)
+        ImAtomicAdd(&g.IO.Fonts->RefCount, 1);
+
     // Add .ini handle for ImGuiWindow and ImGuiTable types
     {
         ImGuiSettingsHandler ini_handler;
@@ -3618,6 +3828,9 @@ void ImGui::Initialize()
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.ReadBinaryFn = WindowSettingsHandler_ReadBinary;
+        ini_handler.WriteBinaryFn = WindowSettingsHandler_WriteBinary;
+        ini_handler.WriteOnlyWhenDirty = false; // Windows may move/resize without MarkIniSettingsDirty() (e.g. auto-resize): entries are compared and cached individually instead
         AddSettingsHandler(&ini_handler);
     }
     TableSettingsAddSettingsHandler();
@@ -3635,6 +3848,7 @@ void ImGui::Initialize()
     ImGuiViewportP* viewport = IM_NEW(ImGuiViewportP)();
     g.Viewports.push_back(viewport);
     g.TempBuffer.resize(1024 * 3 + 1, 0);
+    g.InputEventsQueue.reserve(IMGUI_INPUT_EVENTS_QUEUE_CAPACITY);
 
 #ifdef IMGUI_HAS_DOCK
 #endif
@@ -3652,6 +3866,12 @@ void ImGui::Shutdown()
         g.IO.Fonts->Locked = false;
         IM_DELETE(g.IO.Fonts);
     }
+    else if (g.IO.Fonts)
+    {
+        const int ref_count = ImAtomicAdd(&g.IO.Fonts->RefCount, -1);
+        IM_ASSERT(ref_count >= 0 && "io.Fonts was changed after CreateContext()?");
+        IM_UNUSED(ref_count);
+    }
     g.IO.Fonts = NULL;
     g.DrawListSharedData.TempBuffer.clear();
 
@@ -3660,8 +3880,14 @@ void ImGui::Shutdown()
         return;
 
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
+    // This is the last save: call every handler, including those which missed a call to MarkIniSettingsDirty().
     if (g.SettingsLoaded && g.IO.IniFilename != NULL)
+    {
+        MarkIniSettingsDirty();
         SaveIniSettingsToDisk(g.IO.IniFilename);
+    }
+    if (g.IO.WriteIniSettingsFn != NULL)
+        g.IO.WriteIniSettingsFn(g.IO.WriteIniSettingsUserData, NULL, NULL, 0); // Let user wait for pending write
 
     CallContextHooks(&g, ImGuiContextHookType_Shutdown);
 
@@ -3689,6 +3915,7 @@ void ImGui::Shutdown()
     g.Viewports.clear_delete();
 
     g.TabBars.Clear();
+    g.TabBarsLastTimeActive.clear();
     g.CurrentTabBarStack.clear();
     g.ShrinkWidthBuffer.clear();
 
@@ -3700,12 +3927,22 @@ void ImGui::Shutdown()
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
+    g.FrameArena.ClearFreeMemory();
     g.InputTextState.ClearFreeMemory();
     g.InputTextDeactivatedState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsIndex.Clear();
+    g.SettingsTablesIndex.Clear();
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        handler.WriteCache.clear();
     g.SettingsHandlers.clear();
+    g.SettingsWriteSnapshot[0].clear();
+    g.SettingsWriteSnapshot[1].clear();
+    g.SettingsWindowsTextCache.clear();
+    g.SettingsWindowsTextCacheNext.clear();
 
+    LogFlush();
     if (g.LogFile)
     {
 #ifndef IMGUI_DISABLE_TTY_FUNCTIONS
@@ -3714,6 +3951,13 @@ void ImGui::Shutdown()
             ImFileClose(g.LogFile);
         g.LogFile = NULL;
     }
+    if (g.LogFilename)
+    {
+        if (g.IO.LogWriteFn)
+            g.IO.LogWriteFn(g.IO.LogWriteUserData, g.LogFilename, NULL, 0);
+        g.LogFilename = NULL;
+    }
+    g.LogFilenameBuf.clear();
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
     g.DebugLogIndex.clear();
@@ -3780,6 +4024,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NUL
     DrawList->_Data = &Ctx->DrawListSharedData;
     DrawList->_OwnerName = Name;
     NavPreferredScoringPosRel[0] = NavPreferredScoringPosRel[1] = ImVec2(FLT_MAX, FLT_MAX);
+    NavItemIndex.FrameCount = -1;
 }
 
 ImGuiWindow::~ImGuiWindow()
@@ -3845,6 +4090,9 @@ void ImGui::GcCompactTransientMiscBuffers()
     ImGuiContext& g = *GImGui;
     g.ItemFlagsStack.clear();
     g.GroupStack.clear();
+    g.FrameArena.ClearFreeMemory();
+    if (!g.DragDropActive)
+        g.DragDropPayloadBufHeap.clear();
     TableGcCompactSettings();
 }
 
@@ -3855,6 +4103,7 @@ void ImGui::GcCompactTransientMiscBuffers()
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
     window->MemoryCompacted = true;
+    window->DrawList->_ResetIdxBuffer32();
     window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
@@ -3862,6 +4111,7 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
+    window->NavItemIndex.ClearFreeMemory();
 }
 
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
@@ -3874,6 +4124,145 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+void ImGuiMemoryUsage::AddDrawListSplitter(const ImDrawListSplitter& splitter)
+{
+    AddVector(splitter._Channels);
+    for (int i = 0; i < splitter._Channels.Size; i++)
+        if (i != splitter._Current) // Current channel is a copy of the draw list buffers while splitting, see ImDrawListSplitter::ClearFreeMemory()
+        {
+            AddVector(splitter._Channels[i]._CmdBuffer);
+            AddVector(splitter._Channels[i]._IdxBuffer);
+        }
+}
+
+void ImGuiMemoryUsage::AddDrawList(const ImDrawList& draw_list)
+{
+    AddVector(draw_list.CmdBuffer);
+    AddVector(draw_list.IdxBuffer);
+    AddVector(draw_list.IdxBuffer32);
+    AddVector(draw_list.VtxBuffer);
+    AddVector(draw_list._ClipRectStack);
+    AddVector(draw_list._TextureIdStack);
+    AddVector(draw_list._Path);
+    AddDrawListSplitter(draw_list._Splitter);
+}
+
+// Measure buffers freed by GcCompactTransientWindowBuffers()
+void ImGui::GcCalcWindowMemoryUsage(ImGuiWindow* window, ImGuiMemoryUsage* out_usage)
+{
+    out_usage->AddDrawList(*window->DrawList);
+    out_usage->AddVector(window->IDStack);
+    out_usage->AddVector(window->DC.ChildWindows);
+    out_usage->AddVector(window->DC.ItemWidthStack);
+    out_usage->AddVector(window->DC.TextWrapPosStack);
+    out_usage->AddVector(window->NavItemIndex.Items);
+    out_usage->AddVector(window->NavItemIndex.BucketStart);
+    out_usage->AddVector(window->NavItemIndex.BucketItems);
+}
+
+static void GcCalcObjectMemoryUsage(const ImGuiGcObject& obj, ImGuiMemoryUsage* out_usage)
+{
+    ImGuiContext& g = *GImGui;
+    switch (obj.Type)
+    {
+    case ImGuiGcObjectType_Window:          ImGui::GcCalcWindowMemoryUsage(g.Windows[obj.Index], out_usage); break;
+    case ImGuiGcObjectType_Table:           ImGui::TableGcCalcMemoryUsage(g.Tables.GetByIndex(obj.Index), out_usage); break;
+    case ImGuiGcObjectType_TableTempData:   ImGui::TableGcCalcMemoryUsage(&g.TablesTempData[obj.Index], out_usage); break;
+    case ImGuiGcObjectType_TabBar:          ImGui::TabBarGcCalcMemoryUsage(g.TabBars.GetByIndex(obj.Index), out_usage); break;
+    }
+}
+
+static void GcAddObjectMemoryUsage(ImGuiGcObjectType type, int index, float last_time_active, ImGuiMemoryUsage* out_usage, ImVector<ImGuiGcObject>* out_compactable_objects)
+{
+    ImGuiGcObject obj;
+    obj.Type = type;
+    obj.Index = index;
+    obj.LastTimeActive = last_time_active;
+    ImGuiMemoryUsage usage;
+    GcCalcObjectMemoryUsage(obj, &usage);
+    out_usage->Add(usage);
+    obj.RetainedBytes = usage.RetainedBytes;
+    if (out_compactable_objects && last_time_active >= 0.0f && obj.RetainedBytes > 0)
+        out_compactable_objects->push_back(obj);
+}
+
+// Measure transient buffers of all windows, tables and tab bars, and the frame arena.
+// Optionally output the objects which were not used during last frame and still hold buffers (they may be compacted).
+void ImGui::GcCalcMemoryUsage(ImGuiMemoryUsage* out_usage, ImVector<ImGuiGcObject>* out_compactable_objects)
+{
+    ImGuiContext& g = *GImGui;
+    const int frame_count_prev = g.FrameCount - 1;
+    out_usage->AddFrameArena(g.FrameArena);
+    for (int n = 0; n < g.Windows.Size; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        const bool compactable = !window->WasActive && !window->MemoryCompacted;
+        GcAddObjectMemoryUsage(ImGuiGcObjectType_Window, n, compactable ? window->LastTimeActive : -1.0f, out_usage, out_compactable_objects);
+    }
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+        {
+            const int table_idx = g.Tables.GetIndex(table);
+            const bool compactable = table->LastFrameActive < frame_count_prev && table_idx < g.TablesLastTimeActive.Size;
+            GcAddObjectMemoryUsage(ImGuiGcObjectType_Table, table_idx, compactable ? g.TablesLastTimeActive[table_idx] : -1.0f, out_usage, out_compactable_objects);
+        }
+    for (int n = 0; n < g.TablesTempData.Size; n++)
+    {
+        ImGuiTableTempData* temp_data = &g.TablesTempData[n];
+        const bool compactable = temp_data->LastFrameActive < frame_count_prev;
+        GcAddObjectMemoryUsage(ImGuiGcObjectType_TableTempData, n, compactable ? temp_data->LastTimeActive : -1.0f, out_usage, out_compactable_objects);
+    }
+    for (int n = 0; n < g.TabBars.GetMapSize(); n++)
+        if (ImGuiTabBar* tab_bar = g.TabBars.TryGetMapData(n))
+        {
+            const int tab_bar_idx = g.TabBars.GetIndex(tab_bar);
+            const bool compactable = tab_bar->CurrFrameVisible < frame_count_prev && tab_bar_idx < g.TabBarsLastTimeActive.Size;
+            GcAddObjectMemoryUsage(ImGuiGcObjectType_TabBar, tab_bar_idx, compactable ? g.TabBarsLastTimeActive[tab_bar_idx] : -1.0f, out_usage, out_compactable_objects);
+        }
+}
+
+// Compact least recently used windows/tables/tab bars until transient memory fits io.ConfigMemoryCompactBudget.
+// Only objects which were not used during last frame can be compacted, a limited number of them per frame.
+static void ImGui::GcUpdateMemoryBudget()
+{
+    ImGuiContext& g = *GImGui;
+    g.GcMemoryUsage = ImGuiMemoryUsage();
+    const size_t budget = g.IO.ConfigMemoryCompactBudget;
+    if (budget == 0)
+        return;
+
+    g.GcObjects.resize(0);
+    GcCalcMemoryUsage(&g.GcMemoryUsage, &g.GcObjects);
+    if (g.GcMemoryUsage.RetainedBytes <= budget)
+        return;
+
+    // Frame arena is empty at this point of NewFrame() and cheap to grow again: release it first
+    if (g.FrameArena.Blocks.Size > 0)
+    {
+        g.GcMemoryUsage.RetainedBytes -= (size_t)g.FrameArena.GetCapacityInBytes();
+        g.FrameArena.ClearFreeMemory();
+    }
+    if (g.GcMemoryUsage.RetainedBytes <= budget || g.GcObjects.Size == 0)
+        return;
+
+    struct Func { static int IMGUI_CDECL CompareByLastTimeActive(const void* lhs, const void* rhs) { float a = ((const ImGuiGcObject*)lhs)->LastTimeActive, b = ((const ImGuiGcObject*)rhs)->LastTimeActive; return (a < b) ? -1 : (a > b) ? +1 : 0; } };
+    ImQsort(g.GcObjects.Data, (size_t)g.GcObjects.Size, sizeof(ImGuiGcObject), Func::CompareByLastTimeActive);
+    for (int n = 0; n < g.GcObjects.Size && n < GC_BUDGET_MAX_COMPACT_PER_FRAME && g.GcMemoryUsage.RetainedBytes > budget; n++)
+    {
+        const ImGuiGcObject& obj = g.GcObjects[n];
+        switch (obj.Type)
+        {
+        case ImGuiGcObjectType_Window:          GcCompactTransientWindowBuffers(g.Windows[obj.Index]); break;
+        case ImGuiGcObjectType_Table:           TableGcCompactTransientBuffers(g.Tables.GetByIndex(obj.Index)); break;
+        case ImGuiGcObjectType_TableTempData:   TableGcCompactTransientBuffers(&g.TablesTempData[obj.Index]); break;
+        case ImGuiGcObjectType_TabBar:          TabBarGcCompactTransientBuffers(g.TabBars.GetByIndex(obj.Index)); break;
+        }
+        ImGuiMemoryUsage usage_after;
+        GcCalcObjectMemoryUsage(obj, &usage_after);
+        g.GcMemoryUsage.RetainedBytes -= obj.RetainedBytes - usage_after.RetainedBytes;
+    }
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -4287,7 +4676,60 @@ void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr
         info->TotalFreeCount++;
         //printf("[%05d] MemFree(0x%p)\n", frame_count, ptr);
     }
+
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+    // Attribute allocation to current site (we don't track pointers, so frees are not attributed)
+    if (size == (size_t)-1)
+        return;
+    const int slot = frame_count % IMGUI_DEBUG_ALLOC_SITES_FRAMES;
+    if (info->SitesFrameCount[slot] != frame_count)
+    {
+        info->SitesFrameCount[slot] = frame_count;
+        for (int n = 0; n < info->SitesCount; n++)
+            info->Sites[n].AllocCount[slot] = 0, info->Sites[n].AllocBytes[slot] = 0;
+    }
+    const char* site_name = info->SiteCurrent ? info->SiteCurrent : "(unattributed)";
+    ImGuiDebugAllocSite* site = NULL;
+    for (int n = 0; n < info->SitesCount && site == NULL; n++)
+        if (info->Sites[n].Name == site_name || strcmp(info->Sites[n].Name, site_name) == 0) // Identical literals are not guaranteed to be merged across translation units
+            site = &info->Sites[n];
+    if (site == NULL)
+    {
+        if (info->SitesCount == IMGUI_DEBUG_ALLOC_SITES_MAX)
+        {
+            site = &info->Sites[IMGUI_DEBUG_ALLOC_SITES_MAX - 1];
+            site->Name = "(overflow)";
+        }
+        else
+        {
+            site = &info->Sites[info->SitesCount++];
+            memset(site, 0, sizeof(*site));
+            site->Name = site_name;
+        }
+    }
+    site->AllocCount[slot]++;
+    site->AllocBytes[slot] += size;
+    site->TotalAllocCount++;
+    site->TotalAllocBytes += size;
+#endif
+}
+
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+ImGuiDebugAllocSiteScope::ImGuiDebugAllocSiteScope(const char* name)
+{
+    ImGuiContext* ctx = GImGui;
+    Info = ctx ? &ctx->DebugAllocInfo : NULL;
+    BackupSite = Info ? Info->SiteCurrent : NULL;
+    if (Info)
+        Info->SiteCurrent = name;
+}
+
+ImGuiDebugAllocSiteScope::~ImGuiDebugAllocSiteScope()
+{
+    if (Info)
+        Info->SiteCurrent = BackupSite;
 }
+#endif
 
 const char* ImGui::GetClipboardText()
 {
@@ -4503,6 +4945,7 @@ static bool IsWindowActiveAndVisible(ImGuiWindow* window)
 // The reason this is exposed in imgui_internal.h is: on touch-based system that don't have hovering, we want to dispatch inputs to the right target (imgui vs imgui+app)
 void ImGui::UpdateHoveredWindowAndCaptureFlags()
 {
+    IMGUI_PROFILE_SCOPE("UpdateHoveredWindowAndCaptureFlags");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
     g.WindowsHoverPadding = ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_HOVER_PADDING, WINDOWS_HOVER_PADDING));
@@ -4579,8 +5022,13 @@ void ImGui::UpdateHoveredWindowAndCaptureFlags()
 
 void ImGui::NewFrame()
 {
+    IMGUI_DEBUG_ALLOC_SITE("NewFrame");
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerNewFrame();
+#endif
+    IMGUI_PROFILE_ZONE_BEGIN("NewFrame");
 
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
@@ -4602,6 +5050,7 @@ void ImGui::NewFrame()
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
+    g.FrameArena.Reset();
 
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
@@ -4618,7 +5067,9 @@ void ImGui::NewFrame()
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    // (an immutable atlas is never written to, as other contexts may be reading it from other threads)
+    if (!g.IO.Fonts->Immutable)
+        g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     ImRect virtual_space(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
@@ -4626,6 +5077,10 @@ void ImGui::NewFrame()
         virtual_space.Add(viewport->GetMainRect());
     g.DrawListSharedData.ClipRectFullscreen = virtual_space.ToVec4();
     g.DrawListSharedData.CurveTessellationTol = g.Style.CurveTessellationTol;
+    if (g.IO.ConfigDrawListCurveCache)
+        g.DrawListSharedData.CurveCache.NewFrame();
+    else if (g.DrawListSharedData.CurveCache.Active)
+        g.DrawListSharedData.CurveCache.Clear();
     g.DrawListSharedData.SetCircleTessellationMaxError(g.Style.CircleTessellationMaxError);
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
@@ -4634,8 +5089,10 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
-    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
-        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.Style.AntiAliasedFillUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFillUseTex;
+    if (g.IO.BackendFlags & (ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasIdx32))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset; // With ImGuiBackendFlags_RendererHasIdx32, VtxOffset is removed by PromoteDrawListToIdx32() in Render()
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (ImGuiViewportP* viewport : g.Viewports)
@@ -4805,10 +5262,18 @@ void ImGui::NewFrame()
     for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
         if (table_temp_data.LastTimeActive >= 0.0f && table_temp_data.LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&table_temp_data);
+
+    // Garbage collect transient buffers of recently unused tab bars
+    for (int i = 0; i < g.TabBarsLastTimeActive.Size; i++)
+        if (g.TabBarsLastTimeActive[i] >= 0.0f && g.TabBarsLastTimeActive[i] < memory_compact_start_time)
+            TabBarGcCompactTransientBuffers(g.TabBars.GetByIndex(i));
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
 
+    // Garbage collect transient buffers of least recently used windows/tables/tab bars when over budget
+    GcUpdateMemoryBudget();
+
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
         FocusTopMostWindowUnderOne(NULL, NULL, NULL, ImGuiFocusRequestFlags_RestoreFocusedChild);
@@ -4835,6 +5300,8 @@ void ImGui::NewFrame()
     // Create implicit/fallback window - which we will only render it if the user has added something to it.
     // We don't use "Debug" to avoid colliding with user trying to create a "Debug" window with custom flags.
     // This fallback is particularly important as it prevents ImGui:: calls from crashing.
+    // (the fallback window is not profiled, as it spans from NewFrame() to EndFrame())
+    IMGUI_PROFILE_ZONE_END();
     g.WithinFrameScopeWithImplicitWindow = true;
     SetNextWindowSize(ImVec2(400, 400), ImGuiCond_FirstUseEver);
     Begin("Debug##Default");
@@ -5044,6 +5511,8 @@ static void ImGui::RenderDimmedBackgrounds()
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
+    IMGUI_PROFILE_SCOPE("EndFrame");
+    IMGUI_DEBUG_ALLOC_SITE("EndFrame");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
 
@@ -5056,6 +5525,10 @@ void ImGui::EndFrame()
 
     ErrorCheckEndFrameSanityChecks();
 
+    // Write buffered log output
+    if (g.LogEnabled)
+        LogFlush();
+
     // Notify Platform/OS when our Input Method Editor cursor has moved (e.g. CJK inputs using Microsoft IME)
     ImGuiPlatformImeData* ime_data = &g.PlatformImeData;
     if (g.IO.SetPlatformImeDataFn && memcmp(ime_data, &g.PlatformImeDataPrev, sizeof(ImGuiPlatformImeData)) != 0)
@@ -5126,7 +5599,8 @@ void ImGui::EndFrame()
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+    if (!g.IO.Fonts->Immutable)
+        g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MousePosPrev = g.IO.MousePos;
@@ -5142,6 +5616,8 @@ void ImGui::EndFrame()
 // it is the role of the ImGui_ImplXXXX_RenderDrawData() function provided by the renderer backend)
 void ImGui::Render()
 {
+    IMGUI_PROFILE_SCOPE("Render");
+    IMGUI_DEBUG_ALLOC_SITE("Render");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
 
@@ -5199,6 +5675,35 @@ void ImGui::Render()
         for (ImDrawList* draw_list : draw_data->CmdLists)
             draw_list->_PopUnusedDrawCmd();
 
+        // Optionally merge all draw lists into a single one with fewer draw commands
+        if (g.IO.ConfigDrawDataMerge && draw_data->CmdListsCount > 0)
+        {
+            if (viewport->DrawDataMergedList == NULL)
+            {
+                viewport->DrawDataMergedList = IM_NEW(ImDrawList)(&g.DrawListSharedData);
+                viewport->DrawDataMergedList->_OwnerName = "##DrawDataMerged";
+            }
+            viewport->DrawDataMergeListsCount = draw_data->CmdListsCount;
+            viewport->DrawDataMergeCmdsCount[0] = 0;
+            for (ImDrawList* draw_list : draw_data->CmdLists)
+                viewport->DrawDataMergeCmdsCount[0] += draw_list->CmdBuffer.Size;
+            if (MergeDrawDataIntoSingleList(draw_data, viewport->DrawDataMergedList, (g.IO.BackendFlags & (ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasIdx32)) != 0))
+                viewport->DrawDataMergeCmdsCount[1] = viewport->DrawDataMergedList->CmdBuffer.Size;
+            else
+                viewport->DrawDataMergeCmdsCount[1] = viewport->DrawDataMergeCmdsCount[0];
+        }
+
+        // Convert draw lists split with ImDrawCmd::VtxOffset to 32-bit indices.
+        // Test the last command rather than the vertex count: PrimUnreserve() may bring a list which was split back under 64K vertices
+        // (e.g. AddText() reserves for whitespace). VtxOffset never decreases within a list, so the last command has the largest one.
+        if (sizeof(ImDrawIdx) == 2 && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdx32))
+            for (ImDrawList* draw_list : draw_data->CmdLists)
+                if (draw_list->CmdBuffer.back().VtxOffset != 0)
+                    PromoteDrawListToIdx32(draw_list);
+        if (!(g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset))
+            for (ImDrawList* draw_list : draw_data->CmdLists)
+                IM_ASSERT(draw_list->CmdBuffer.back().VtxOffset == 0 && "Renderer backend doesn't support ImDrawCmd::VtxOffset!");
+
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
@@ -5679,6 +6184,7 @@ static void InitOrLoadWindowSettings(ImGuiWindow* window, ImGuiWindowSettings* s
 
 static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
+    IMGUI_DEBUG_ALLOC_SITE("CreateNewWindow");
     // Create window the first time
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
     ImGuiContext& g = *GImGui;
@@ -5688,8 +6194,12 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 
     ImGuiWindowSettings* settings = NULL;
     if (!(flags & ImGuiWindowFlags_NoSavedSettings))
+    {
         if ((settings = ImGui::FindWindowSettingsByWindow(window)) != 0)
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
+        else if (ImGuiSettingsHandler* handler = ImGui::FindSettingsHandler("Window"))
+            handler->WantWrite = true; // Include new window in next save, even if its settings are not marked dirty.
+    }
 
     InitOrLoadWindowSettings(window, settings);
 
@@ -6405,6 +6915,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const int current_frame = g.FrameCount;
     const bool first_begin_of_the_frame = (window->LastFrameActive != current_frame);
     window->IsFallbackWindow = (g.CurrentWindowStack.Size == 0 && g.WithinFrameScopeWithImplicitWindow);
+    if (!window->IsFallbackWindow)
+        IMGUI_PROFILE_ZONE_BEGIN(window->Name); // Zone ends in End()
 
     // Update the Appearing flag
     bool window_just_activated_by_user = (window->LastFrameActive < current_frame - 1);   // Not using !WasActive because the implicit "Debug" window would always toggle off->on
@@ -6546,6 +7058,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // Restore buffer capacity when woken from a compacted state, to avoid
         if (window->MemoryCompacted)
             GcAwakeTransientWindowBuffers(window);
+        NavItemIndexNewFrame(window);
 
         // Update stored window name when it changes (which can _only_ happen with the "###" operator, so the ID would stay unchanged).
         // The title bar always display the 'name' parameter, so we only update the string storage if it needs to be visible to the end-user elsewhere.
@@ -7111,6 +7624,8 @@ void ImGui::End()
 
     if (window->DC.IsSetPos)
         ErrorCheckUsingSetCursorPosToExtendParentBoundaries();
+    if (!window->IsFallbackWindow)
+        IMGUI_PROFILE_ZONE_END();
 
     // Pop from window stack
     g.LastItemData = g.CurrentWindowStack.back().ParentLastItemDataBackup;
@@ -7295,6 +7810,7 @@ void ImGui::SetCurrentFont(ImFont* font)
     ImGuiContext& g = *GImGui;
     IM_ASSERT(font && font->IsLoaded());    // Font Atlas not created. Did you call io.Fonts->GetTexDataAsRGBA32 / GetTexDataAsAlpha8 ?
     IM_ASSERT(font->Scale > 0.0f);
+    IM_ASSERT((!font->IsSDF || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSDF)) && "Font was baked with ImFontConfig::SDF but renderer backend doesn't support ImDrawCmdFlags_SDF!");
     g.Font = font;
     g.FontBaseSize = ImMax(1.0f, g.IO.FontGlobalScale * g.Font->FontSize * g.Font->Scale);
     g.FontSize = g.CurrentWindow ? g.CurrentWindow->CalcFontSize() : 0.0f;
@@ -7302,6 +7818,8 @@ void ImGui::SetCurrentFont(ImFont* font)
     ImFontAtlas* atlas = g.Font->ContainerAtlas;
     g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel;
     g.DrawListSharedData.TexUvLines = atlas->TexUvLines;
+    g.DrawListSharedData.TexUvRoundCornersFilled = atlas->TexUvRoundCornersFilled;
+    g.DrawListSharedData.TexUvRoundCornersStroke = atlas->TexUvRoundCornersStroke;
     g.DrawListSharedData.Font = g.Font;
     g.DrawListSharedData.FontSize = g.FontSize;
 }
@@ -7662,6 +8180,8 @@ void ImGui::SetWindowCollapsed(ImGuiWindow* window, bool collapsed, ImGuiCond co
     window->SetWindowCollapsedAllowFlags &= ~(ImGuiCond_Once | ImGuiCond_FirstUseEver | ImGuiCond_Appearing);
 
     // Set
+    if (window->Collapsed != collapsed)
+        MarkIniSettingsDirty(window);
     window->Collapsed = collapsed;
 }
 
@@ -8814,6 +9334,7 @@ static void ImGui::UpdateKeyboardInputs()
 
 static void ImGui::UpdateMouseInputs()
 {
+    IMGUI_PROFILE_SCOPE("UpdateMouseInputs");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -9076,6 +9597,7 @@ static void DebugPrintInputEvent(const char* prefix, const ImGuiInputEvent* e)
 // - trickle_fast_inputs = true  : process as many events as possible (successive down/up/down/up will be trickled over several frames so nothing is lost) (new feature in 1.87)
 void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 {
+    IMGUI_PROFILE_SCOPE("UpdateInputEvents");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -9176,6 +9698,22 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
     for (int n = 0; n < event_n; n++)
         g.InputEventsTrail.push_back(g.InputEventsQueue[n]);
 
+    // Update statistics
+    ImGuiInputEventsStats* stats = &g.InputEventsStats;
+    stats->ProcessedCount = event_n;
+    stats->CoalescedCount = stats->CoalescedCountPending;
+    stats->CoalescedCountPending = 0;
+    stats->LatencyLast = 0.0f;
+    const ImU64 time_processed = (event_n > 0) ? ImGetTimeNs() : 0;
+    for (int n = 0; n < event_n; n++)
+        if (!g.InputEventsQueue[n].AddedByTestEngine && g.InputEventsQueue[n].TimeNs != 0 && time_processed > g.InputEventsQueue[n].TimeNs)
+            stats->LatencyLast = ImMax(stats->LatencyLast, (float)((double)(time_processed - g.InputEventsQueue[n].TimeNs) * 1e-9));
+    if (event_n > 0)
+    {
+        stats->LatencyAvg = (stats->LatencyAvg == 0.0f) ? stats->LatencyLast : ImLerp(stats->LatencyAvg, stats->LatencyLast, 0.10f);
+        stats->LatencyPeak = ImMax(stats->LatencyPeak, stats->LatencyLast);
+    }
+
     // [DEBUG]
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (event_n != 0 && (g.DebugLogFlags & ImGuiDebugLogFlags_EventIO))
@@ -9184,10 +9722,7 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
 #endif
 
     // Remaining events will be processed on the next frame
-    if (event_n == g.InputEventsQueue.Size)
-        g.InputEventsQueue.resize(0);
-    else
-        g.InputEventsQueue.erase(g.InputEventsQueue.Data, g.InputEventsQueue.Data + event_n);
+    g.InputEventsQueue.pop_front(event_n);
 
     // Clear buttons state when focus is lost
     // - this is useful so e.g. releasing Alt after focus loss on Alt-Tab doesn't trigger the Alt menu toggle.
@@ -9438,6 +9973,13 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     // Check: the io.ConfigWindowsResizeFromEdges option requires backend to honor mouse cursor changes and set the ImGuiBackendFlags_HasMouseCursors flag accordingly.
     if (g.IO.ConfigWindowsResizeFromEdges && !(g.IO.BackendFlags & ImGuiBackendFlags_HasMouseCursors))
         g.IO.ConfigWindowsResizeFromEdges = false;
+
+    // Check: the compact ImDrawVert layout (IMGUI_USE_COMPACT_DRAWVERT) requires renderer backend to decode it and set the ImGuiBackendFlags_RendererHasCompactVtx flag accordingly.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    if (g.IO.BackendRendererName != NULL)
+        IM_ASSERT((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasCompactVtx) && "IMGUI_USE_COMPACT_DRAWVERT is enabled but renderer backend doesn't support it!");
+    IM_ASSERT(g.IO.DisplaySize.x <= IMGUI_COMPACT_DRAWVERT_POS_RANGE && g.IO.DisplaySize.y <= IMGUI_COMPACT_DRAWVERT_POS_RANGE && "io.DisplaySize exceeds the position range of IMGUI_USE_COMPACT_DRAWVERT, see IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS!");
+#endif
 }
 
 static void ImGui::ErrorCheckEndFrameSanityChecks()
@@ -9723,6 +10265,12 @@ bool ImGui::ItemAdd(const ImRect& bb, ImGuiID id, const ImRect* nav_bb_arg, ImGu
                 if (g.NavWindow->RootWindowForNav == window->RootWindowForNav)
                     if (window == g.NavWindow || ((window->Flags | g.NavWindow->Flags) & ImGuiWindowFlags_NavFlattened))
                         NavProcessItem();
+            if (window->DC.NavLayerCurrent == ImGuiNavLayer_Main)
+            {
+                window->NavItemIndex.ItemsCount++;
+                if (window->NavItemIndex.IsRecording)
+                    NavItemIndexAddItem(window);
+            }
         }
 
         // [DEBUG] People keep stumbling on this problem and using "" as identifier in the root of a window instead of "##something".
@@ -11101,10 +11649,7 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
     if (g.NavLayer != window->DC.NavLayerCurrent)
         return false;
 
-    // FIXME: Those are not good variables names
     ImRect cand = g.LastItemData.NavRect;   // Current item nav rectangle
-    const ImRect curr = g.NavScoringRect;   // Current modified source rect (NB: we've applied Max.x = Min.x in NavUpdate() to inhibit the effect of having varied item width)
-    g.NavScoringDebugCount++;
 
     // When entering through a NavFlattened border, we consider child window items as fully clipped for scoring
     if (window->ParentWindow == g.NavWindow)
@@ -11114,6 +11659,18 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
             return false;
         cand.ClipWithFull(window->ClipRect); // This allows the scored item to not overlap other candidates in the parent window
     }
+    return NavScoreItemEx(result, window, cand, g.LastItemData.ID);
+}
+
+// Score 'cand' against g.NavScoringRect. Also used by NavItemIndexScore() for items retained from last frame.
+static bool ImGui::NavScoreItemEx(ImGuiNavItemData* result, ImGuiWindow* window, const ImRect& cand, ImGuiID cand_id)
+{
+    ImGuiContext& g = *GImGui;
+    IM_UNUSED(window);
+
+    // FIXME: Those are not good variables names
+    const ImRect curr = g.NavScoringRect;   // Current modified source rect (NB: we've applied Max.x = Min.x in NavUpdate() to inhibit the effect of having varied item width)
+    g.NavScoringDebugCount++;
 
     // Compute distance between boxes
     // FIXME-NAV: Introducing biases for vertical navigation, needs to be removed.
@@ -11150,7 +11707,7 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
     else
     {
         // Degenerate case: two overlapping buttons with same center, break ties arbitrarily (note that LastItemId here is really the _previous_ item order, but it doesn't matter)
-        quadrant = (g.LastItemData.ID < g.NavId) ? ImGuiDir_Left : ImGuiDir_Right;
+        quadrant = (cand_id < g.NavId) ? ImGuiDir_Left : ImGuiDir_Right;
     }
 
     const ImGuiDir move_dir = g.NavMoveDir;
@@ -11182,7 +11739,7 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result)
             draw_list->AddRectFilled(cand.Max - ImVec2(4, 4), cand.Max + CalcTextSize(buf) + ImVec2(4, 4), IM_COL32(40, 0, 0, 200));
             draw_list->AddText(cand.Max, ~0U, buf);
         }
-        if (debug_tty) { IMGUI_DEBUG_LOG_NAV("id 0x%08X\n%s\n", g.LastItemData.ID, buf); }
+        if (debug_tty) { IMGUI_DEBUG_LOG_NAV("id 0x%08X\n%s\n", cand_id, buf); }
     }
 #endif
 
@@ -11331,6 +11888,242 @@ static void ImGui::NavProcessItem()
     }
 }
 
+// Windows with many navigable items (e.g. large tables or lists submitted without a clipper) retain their Main layer items
+// from last frame, bucketed by Y position. A directional move request can then be resolved from NavUpdate() by scoring the few
+// items surrounding the scoring rectangle, and applied on the same frame, instead of scoring every item as it gets submitted
+// and applying the result on the following frame. The result is identical to what the regular scoring pass would produce on
+// an unchanged layout. If the layout changed, the usual handling of a NavId that is not alive applies.
+// Anything the index can't reproduce (tabbing, wrapping, menus, flattened child windows, clipped lists..) uses the regular pass.
+static void ImGui::NavItemIndexNewFrame(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiNavItemIndex* index = &window->NavItemIndex;
+    // Only record while keyboard/gamepad navigation is in use in this window, so other windows and mouse users don't pay for it.
+    const bool nav_enabled = (g.IO.ConfigFlags & (ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_NavEnableGamepad)) != 0;
+    const bool nav_active = nav_enabled && g.NavWindow == window && !g.NavDisableHighlight;
+    index->IsRecording = nav_active && index->ItemsCount >= NAV_ITEM_INDEX_MIN_ITEMS && (window->Flags & (ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_ChildMenu)) == 0;
+    index->IsSortedY = true;
+    index->IsIncomplete = false;
+    index->InterceptDirMask = 0;
+    index->ItemsCount = 0;
+    if (index->IsRecording)
+    {
+        index->Items.resize(0);
+        index->BucketStart.resize(0);
+        index->ItemsMaxHeight = 0.0f;
+        index->ItemsMinX = +FLT_MAX;
+        index->ItemsMaxX = -FLT_MAX;
+        index->FrameCount = g.FrameCount;
+    }
+    else
+    {
+        index->FrameCount = -1; // Keep buffers around until the window gets garbage collected, see GcCompactTransientWindowBuffers()
+    }
+}
+
+static void ImGui::NavItemIndexAddItem(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiItemFlags item_flags = g.LastItemData.InFlags;
+    if (item_flags & ImGuiItemFlags_Disabled)
+        return;
+
+    // Same clamping and visibility test as NavProcessItem()
+    ImRect nav_bb = g.LastItemData.NavRect;
+    if (window->DC.NavIsScrollPushableX == false)
+    {
+        nav_bb.Min.x = ImClamp(nav_bb.Min.x, window->ClipRect.Min.x, window->ClipRect.Max.x);
+        nav_bb.Max.x = ImClamp(nav_bb.Max.x, window->ClipRect.Min.x, window->ClipRect.Max.x);
+    }
+    const float VISIBLE_RATIO = 0.70f;
+    bool is_mostly_visible = false;
+    if (window->ClipRect.Overlaps(nav_bb))
+        is_mostly_visible = (ImClamp(nav_bb.Max.y, window->ClipRect.Min.y, window->ClipRect.Max.y) - ImClamp(nav_bb.Min.y, window->ClipRect.Min.y, window->ClipRect.Max.y) >= (nav_bb.Max.y - nav_bb.Min.y) * VISIBLE_RATIO);
+
+    ImGuiNavItemIndex* index = &window->NavItemIndex;
+    const ImRect rect_rel = WindowRectAbsToRel(window, nav_bb);
+    if (index->Items.Size > 0 && rect_rel.Min.y < index->Items.back().RectRel.Min.y)
+        index->IsSortedY = false;
+    index->ItemsMaxHeight = ImMax(index->ItemsMaxHeight, rect_rel.GetHeight());
+    index->ItemsMinX = ImMin(index->ItemsMinX, rect_rel.Min.x);
+    index->ItemsMaxX = ImMax(index->ItemsMaxX, rect_rel.Max.x);
+
+    index->Items.resize(index->Items.Size + 1);
+    ImGuiNavItemIndexEntry* item = &index->Items.back();
+    item->ID = g.LastItemData.ID;
+    item->FocusScopeId = g.CurrentFocusScopeId;
+    item->RectRel = rect_rel;
+    item->InFlags = item_flags;
+    item->IsMostlyVisible = is_mostly_visible;
+    item->SelectionUserData = (item_flags & ImGuiItemFlags_HasSelectionUserData) ? g.NextItemData.SelectionUserData : ImGuiSelectionUserData_Invalid;
+}
+
+static int NavItemIndexGetBucket(const ImGuiNavItemIndex* index, float y)
+{
+    const int buckets_count = index->BucketStart.Size - 1;
+    const float f = (y - index->BucketMinY) / index->BucketHeight;
+    return (f >= (float)(buckets_count - 1)) ? buckets_count - 1 : (f <= 0.0f) ? 0 : (int)f;
+}
+
+// Only needed when items were not submitted in increasing Y order
+static void NavItemIndexBuildBuckets(ImGuiNavItemIndex* index)
+{
+    const int items_count = index->Items.Size;
+    float min_y = +FLT_MAX, max_y = -FLT_MAX, total_h = 0.0f;
+    for (const ImGuiNavItemIndexEntry& item : index->Items)
+    {
+        min_y = ImMin(min_y, item.RectRel.Min.y);
+        max_y = ImMax(max_y, item.RectRel.Min.y);
+        total_h += item.RectRel.GetHeight();
+    }
+
+    // Aim for one bucket per row of items
+    const float bucket_h = ImMax(total_h / items_count, 1.0f);
+    const float rows = (max_y - min_y) / bucket_h;
+    const int buckets_count = (rows >= (float)(items_count - 1)) ? items_count : (int)rows + 1;
+    index->BucketMinY = min_y;
+    index->BucketMaxY = max_y;
+    index->BucketHeight = bucket_h;
+
+    // Counting sort, preserving submission order within each bucket
+    index->BucketStart.resize(buckets_count + 1);
+    memset(index->BucketStart.Data, 0, (size_t)index->BucketStart.size_in_bytes());
+    index->BucketItems.resize(items_count);
+    for (const ImGuiNavItemIndexEntry& item : index->Items)
+        index->BucketStart[NavItemIndexGetBucket(index, item.RectRel.Min.y) + 1]++;
+    for (int bucket_n = 0; bucket_n < buckets_count; bucket_n++)
+        index->BucketStart[bucket_n + 1] += index->BucketStart[bucket_n];
+    for (int item_n = 0; item_n < items_count; item_n++)
+        index->BucketItems[index->BucketStart[NavItemIndexGetBucket(index, index->Items[item_n].RectRel.Min.y)]++] = item_n;
+    for (int bucket_n = buckets_count; bucket_n > 0; bucket_n--)
+        index->BucketStart[bucket_n] = index->BucketStart[bucket_n - 1];
+    index->BucketStart[0] = 0;
+}
+
+// Score items from the index into 'result'.
+// Buckets are visited outward from the scoring rectangle until their distance exceeds the best candidate, then the visited
+// items are scored again in submission order, so that ties are broken exactly like the regular scoring pass would.
+static void ImGui::NavItemIndexScore(ImGuiWindow* window, ImGuiNavItemData* result, bool visible_only)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiNavItemIndex* index = &window->NavItemIndex;
+    ImVector<int>& candidates = g.NavItemIndexCandidates;
+    candidates.resize(0);
+    candidates.reserve(index->Items.Size); // Each item is visited at most once: avoid reallocating as the visited area varies
+
+    // NavScoreItemEx() measures vertical distance between the [20%,80%] vertical spans of the boxes, and vertical distance
+    // is a lower bound of the box distance. Items in a bucket have their Min.y within the bucket and are at most ItemsMaxHeight tall.
+    const ImGuiDir move_dir = g.NavMoveDir;
+    const ImRect curr = WindowRectAbsToRel(window, g.NavScoringRect);
+    const float curr_min_y = ImLerp(curr.Min.y, curr.Max.y, 0.2f);
+    const float curr_max_y = ImLerp(curr.Min.y, curr.Max.y, 0.8f);
+    const float max_h = index->ItemsMaxHeight;
+    const float MARGIN = 1.0f;
+
+    // Left/Right candidates need a horizontal distance larger than the vertical one. When vertical distance is not zero,
+    // horizontal distance gets scaled down to 1.0f + dx / 1000.0f (see NavScoreItemEx()), which gives an upper bound.
+    float max_dist_y = FLT_MAX;
+    if (move_dir == ImGuiDir_Left || move_dir == ImGuiDir_Right)
+        max_dist_y = 1.0f + ImMax(ImFabs(index->ItemsMaxX - curr.Min.x), ImFabs(curr.Max.x - index->ItemsMinX)) / 1000.0f + MARGIN;
+
+    // When items are sorted by Y, each item acts as its own bucket.
+    ImGuiNavItemData best;
+    const bool is_sorted = index->IsSortedY;
+    const int buckets_count = is_sorted ? index->Items.Size : index->BucketStart.Size - 1;
+    int bucket_start;
+    if (is_sorted)
+    {
+        // Binary search first item at or below the center of the scoring rectangle
+        const float center_y = curr.GetCenter().y;
+        int lo = 0, hi = index->Items.Size;
+        while (lo < hi)
+        {
+            const int mid = (lo + hi) >> 1;
+            if (index->Items[mid].RectRel.Min.y < center_y)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        bucket_start = lo;
+    }
+    else
+    {
+        bucket_start = NavItemIndexGetBucket(index, curr.GetCenter().y);
+    }
+    for (int pass = 0; pass < 2; pass++)
+    {
+        // Pass 0 goes down from the scoring rectangle, pass 1 goes up
+        const int step = (pass == 0) ? +1 : -1;
+        for (int bucket_n = (pass == 0) ? bucket_start : bucket_start - 1; bucket_n >= 0 && bucket_n < buckets_count; bucket_n += step)
+        {
+            const float bucket_min_y = (is_sorted ? index->Items[bucket_n].RectRel.Min.y : index->BucketMinY + bucket_n * index->BucketHeight) - MARGIN;
+            const float bucket_max_y = (is_sorted ? index->Items[bucket_n].RectRel.Min.y : (bucket_n == buckets_count - 1) ? index->BucketMaxY : index->BucketMinY + (bucket_n + 1) * index->BucketHeight) + MARGIN;
+            const float dist_y = ImMax(0.0f, ImMax(bucket_min_y - curr_max_y, curr_min_y - (bucket_max_y + max_h)));
+            if (dist_y > best.DistBox || (dist_y > 0.0f && dist_y > max_dist_y))
+                break;
+            if ((pass == 0 && move_dir == ImGuiDir_Up && bucket_min_y > curr.Max.y + max_h) || (pass == 1 && move_dir == ImGuiDir_Down && bucket_max_y < curr.Min.y - max_h))
+                break; // Items beyond this point are all on the wrong side of the scoring rectangle
+
+            const int item_begin = is_sorted ? bucket_n : index->BucketStart[bucket_n];
+            const int item_end = is_sorted ? bucket_n + 1 : index->BucketStart[bucket_n + 1];
+            for (int n = item_begin; n < item_end; n++)
+            {
+                const int item_n = is_sorted ? n : index->BucketItems[n];
+                const ImGuiNavItemIndexEntry& item = index->Items[item_n];
+                if ((visible_only && !item.IsMostlyVisible) || (item.ID == g.NavId && (g.NavMoveFlags & ImGuiNavMoveFlags_AllowCurrentNavId) == 0))
+                    continue;
+                NavScoreItemEx(&best, window, WindowRectRelToAbs(window, item.RectRel), item.ID);
+                candidates.push_back(item_n);
+            }
+        }
+    }
+    if (best.DistBox == FLT_MAX)
+        return;
+
+    struct Func { static int IMGUI_CDECL IndexComparer(const void* lhs, const void* rhs) { return *(const int*)lhs - *(const int*)rhs; } };
+    ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(int), Func::IndexComparer);
+    for (int item_n : candidates)
+    {
+        const ImGuiNavItemIndexEntry& item = index->Items[item_n];
+        if (!NavScoreItemEx(result, window, WindowRectRelToAbs(window, item.RectRel), item.ID))
+            continue;
+        result->Window = window;
+        result->ID = item.ID;
+        result->FocusScopeId = item.FocusScopeId;
+        result->InFlags = item.InFlags;
+        result->RectRel = item.RectRel;
+        result->SelectionUserData = item.SelectionUserData;
+    }
+}
+
+static bool ImGui::NavMoveRequestResolveWithItemIndex()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.NavWindow;
+    if (window == NULL || g.NavId == 0 || !g.NavIdIsAlive || g.NavLayer != ImGuiNavLayer_Main || g.NavMoveDir == ImGuiDir_None || IMGUI_DEBUG_NAV_SCORING)
+        return false;
+    if (g.NavMoveFlags & (ImGuiNavMoveFlags_IsTabbing | ImGuiNavMoveFlags_Forwarded))
+        return false;
+    ImGuiNavItemIndex* index = &window->NavItemIndex;
+    if (index->FrameCount != g.FrameCount - 1 || index->IsIncomplete || index->Items.Size == 0 || (index->InterceptDirMask & (1 << g.NavMoveDir)))
+        return false;
+    if (window->RootWindowForNav != window || window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX)
+        return false;
+    for (ImGuiWindow* child_window : window->DC.ChildWindows)
+        if (child_window->Flags & ImGuiWindowFlags_NavFlattened)
+            return false;
+
+    if (!index->IsSortedY && index->BucketStart.Size == 0)
+        NavItemIndexBuildBuckets(index);
+    NavItemIndexScore(window, &g.NavMoveResultLocal, false);
+    if (g.NavMoveResultLocal.ID == 0)
+        return false; // Let the regular scoring pass handle failure (e.g. to apply wrapping)
+    if (g.NavMoveFlags & ImGuiNavMoveFlags_AlsoScoreVisibleSet)
+        NavItemIndexScore(window, &g.NavMoveResultLocalVisible, true);
+    IMGUI_DEBUG_LOG_NAV("[nav] NavMoveRequest: resolved from item index of \"%s\" (%d items, %d scored)\n", window->Name, index->Items.Size, g.NavScoringDebugCount);
+    return true;
+}
+
 // Handle "scoring" of an item for a tabbing/focusing request initiated by NavUpdateCreateTabbingRequest().
 // Note that SetKeyboardFocusHere() API calls are considered tabbing requests!
 // - Case 1: no nav/active id:    set result to first eligible item, stop storing.
@@ -11621,6 +12414,7 @@ float ImGui::GetNavTweakPressedAmount(ImGuiAxis axis)
 
 static void ImGui::NavUpdate()
 {
+    IMGUI_PROFILE_SCOPE("NavUpdate");
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -11723,6 +12517,14 @@ static void ImGui::NavUpdate()
     if (g.NavMoveDir == ImGuiDir_None)
         NavUpdateCreateTabbingRequest();
     NavUpdateAnyRequestFlag();
+
+    // In windows with many items, try resolving the move request immediately using items retained from last frame
+    if (g.NavMoveSubmitted && NavMoveRequestResolveWithItemIndex())
+    {
+        NavMoveRequestApplyResult();
+        g.NavMoveSubmitted = g.NavMoveScoringItems = false;
+        NavUpdateAnyRequestFlag();
+    }
     g.NavIdIsAlive = false;
 
     // Scrolling
@@ -12205,6 +13007,7 @@ static float ImGui::NavUpdatePageUpPageDown()
 
 static void ImGui::NavEndFrame()
 {
+    IMGUI_PROFILE_SCOPE("NavEndFrame");
     ImGuiContext& g = *GImGui;
 
     // Show CTRL+TAB list window
@@ -12569,7 +13372,7 @@ void ImGui::ClearDragDrop()
     g.DragDropAcceptIdCurrRectSurface = FLT_MAX;
     g.DragDropAcceptFrameCount = -1;
 
-    g.DragDropPayloadBufHeap.clear();
+    g.DragDropPayloadBufHeap.resize(0); // Keep capacity for next payload, see GcCompactTransientMiscBuffers()
     memset(&g.DragDropPayloadBufLocal, 0, sizeof(g.DragDropPayloadBufLocal));
 }
 
@@ -12753,6 +13556,46 @@ bool ImGui::SetDragDropPayload(const char* type, const void* data, size_t data_s
             payload.Data = NULL;
         }
         payload.DataSize = (int)data_size;
+        payload.DataCallback = NULL;
+        payload.DataCallbackUserData = NULL;
+        payload.DataCallbackCalled = false;
+    }
+    payload.DataFrameCount = g.FrameCount;
+
+    // Return whether the payload has been accepted
+    return (g.DragDropAcceptFrameCount == g.FrameCount) || (g.DragDropAcceptFrameCount == g.FrameCount - 1);
+}
+
+// Same as SetDragDropPayload() without copying data, which can be large (e.g. list of selected items) and set every frame.
+// The optional callback lets the source create data only when a target accepts the payload.
+bool ImGui::SetDragDropPayloadNoCopy(const char* type, const void* data, size_t data_size, ImGuiCond cond, ImGuiPayloadCallback callback, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiPayload& payload = g.DragDropPayload;
+    if (cond == 0)
+        cond = ImGuiCond_Always;
+
+    IM_ASSERT(type != NULL);
+    IM_ASSERT(strlen(type) < IM_ARRAYSIZE(payload.DataType) && "Payload type can be at most 32 characters long");
+    IM_ASSERT((data != NULL && data_size > 0) || (data == NULL && data_size == 0));
+    IM_ASSERT(data_size <= INT_MAX);
+    IM_ASSERT(cond == ImGuiCond_Always || cond == ImGuiCond_Once);
+    IM_ASSERT(payload.SourceId != 0);                               // Not called between BeginDragDropSource() and EndDragDropSource()
+
+    if (cond == ImGuiCond_Always || payload.DataFrameCount == -1)
+    {
+        // Keep data already provided by the callback when the same payload is submitted again
+        const bool keep_data = callback != NULL && payload.DataCallbackCalled && payload.DataCallback == callback && payload.DataCallbackUserData == user_data && strcmp(payload.DataType, type) == 0;
+        if (!keep_data)
+        {
+            ImStrncpy(payload.DataType, type, IM_ARRAYSIZE(payload.DataType));
+            g.DragDropPayloadBufHeap.resize(0);
+            payload.Data = (void*)data;
+            payload.DataSize = (int)data_size;
+            payload.DataCallback = callback;
+            payload.DataCallbackUserData = user_data;
+            payload.DataCallbackCalled = false;
+        }
     }
     payload.DataFrameCount = g.FrameCount;
 
@@ -12856,6 +13699,13 @@ const ImGuiPayload* ImGui::AcceptDragDropPayload(const char* type, ImGuiDragDrop
     if (!payload.Delivery && !(flags & ImGuiDragDropFlags_AcceptBeforeDelivery))
         return NULL;
 
+    // Let the source create data (see SetDragDropPayloadNoCopy())
+    if (payload.DataCallback != NULL && !payload.DataCallbackCalled)
+    {
+        payload.DataCallbackCalled = true;
+        payload.DataCallback(&payload, payload.DataCallbackUserData);
+    }
+
     //IMGUI_DEBUG_LOG("AcceptDragDropPayload(): %08X: return payload\n", g.DragDropTargetId);
     return &payload;
 }
@@ -12901,19 +13751,28 @@ void ImGui::EndDragDropTarget()
 // By default, tree nodes are automatically opened during logging.
 //-----------------------------------------------------------------------------
 
+// When logging to file/tty, output is accumulated in g.LogBuffer and written once it reaches io.LogFlushThreshold bytes.
+static inline void LogFlushIfNeeded(ImGuiContext& g)
+{
+    if (g.LogBuffer.size() >= g.IO.LogFlushThreshold && (g.LogType == ImGuiLogType_File || g.LogType == ImGuiLogType_TTY))
+        ImGui::LogFlush();
+}
+
 // Pass text data straight to log (without being displayed)
 static inline void LogTextV(ImGuiContext& g, const char* fmt, va_list args)
 {
-    if (g.LogFile)
-    {
-        g.LogBuffer.Buf.resize(0);
-        g.LogBuffer.appendfv(fmt, args);
-        ImFileWrite(g.LogBuffer.c_str(), sizeof(char), (ImU64)g.LogBuffer.size(), g.LogFile);
-    }
-    else
-    {
-        g.LogBuffer.appendfv(fmt, args);
-    }
+    g.LogBuffer.appendfv(fmt, args);
+    LogFlushIfNeeded(g);
+}
+
+// Unformatted version of LogTextV(), prefixed with 'indentation' spaces
+static void LogTextUnformatted(ImGuiContext& g, int indentation, const char* text, const char* text_end)
+{
+    static const char spaces[] = "                                ";
+    for (; indentation > 0; indentation -= IM_ARRAYSIZE(spaces) - 1)
+        g.LogBuffer.append(spaces, spaces + ImMin(indentation, IM_ARRAYSIZE(spaces) - 1));
+    g.LogBuffer.append(text, text_end);
+    LogFlushIfNeeded(g);
 }
 
 void ImGui::LogText(const char* fmt, ...)
@@ -12957,7 +13816,7 @@ void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char*
         g.LogLinePosY = ref_pos->y;
     if (log_new_line)
     {
-        LogText(IM_NEWLINE);
+        LogTextUnformatted(g, 0, IM_NEWLINE, NULL);
         g.LogLineFirstItem = true;
     }
 
@@ -12979,13 +13838,12 @@ void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char*
         const bool is_last_line = (line_end == text_end);
         if (line_start != line_end || !is_last_line)
         {
-            const int line_length = (int)(line_end - line_start);
             const int indentation = g.LogLineFirstItem ? tree_depth * 4 : 1;
-            LogText("%*s%.*s", indentation, "", line_length, line_start);
+            LogTextUnformatted(g, indentation, line_start, line_end);
             g.LogLineFirstItem = false;
             if (*line_end == '\n')
             {
-                LogText(IM_NEWLINE);
+                LogTextUnformatted(g, 0, IM_NEWLINE, NULL);
                 g.LogLineFirstItem = true;
             }
         }
@@ -13049,6 +13907,18 @@ void ImGui::LogToFile(int auto_open_depth, const char* filename)
         filename = g.IO.LogFilename;
     if (!filename || !filename[0])
         return;
+
+    // Output is passed to io.LogWriteFn() which is in charge of writing to the file.
+    if (g.IO.LogWriteFn != NULL)
+    {
+        LogBegin(ImGuiLogType_File, auto_open_depth);
+        const int filename_size = (int)strlen(filename) + 1;
+        g.LogFilenameBuf.resize(filename_size);
+        memcpy(g.LogFilenameBuf.Data, filename, (size_t)filename_size);
+        g.LogFilename = g.LogFilenameBuf.Data;
+        return;
+    }
+
     ImFileHandle f = ImFileOpen(filename, "ab");
     if (!f)
     {
@@ -13084,6 +13954,7 @@ void ImGui::LogFinish()
         return;
 
     LogText(IM_NEWLINE);
+    LogFlush();
     switch (g.LogType)
     {
     case ImGuiLogType_TTY:
@@ -13092,7 +13963,11 @@ void ImGui::LogFinish()
 #endif
         break;
     case ImGuiLogType_File:
-        ImFileClose(g.LogFile);
+        if (g.LogFile)
+            ImFileClose(g.LogFile);
+        else if (g.IO.LogWriteFn)
+            g.IO.LogWriteFn(g.IO.LogWriteUserData, g.LogFilename, NULL, 0);
+        g.LogFilename = NULL;
         break;
     case ImGuiLogType_Buffer:
         break;
@@ -13108,7 +13983,25 @@ void ImGui::LogFinish()
     g.LogEnabled = false;
     g.LogType = ImGuiLogType_None;
     g.LogFile = NULL;
-    g.LogBuffer.clear();
+
+    // Keep write buffer allocated for next capture, unless it grew large (e.g. when capturing to clipboard)
+    if (g.LogBuffer.Buf.Capacity > g.IO.LogFlushThreshold * 2)
+        g.LogBuffer.clear();
+    else
+        g.LogBuffer.Buf.resize(0);
+}
+
+// Write output accumulated while logging to file/tty
+void ImGui::LogFlush()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.LogBuffer.empty() || (g.LogType != ImGuiLogType_File && g.LogType != ImGuiLogType_TTY))
+        return;
+    if (g.LogFile)
+        ImFileWrite(g.LogBuffer.c_str(), sizeof(char), (ImU64)g.LogBuffer.size(), g.LogFile);
+    else if (g.LogFilename && g.IO.LogWriteFn)
+        g.IO.LogWriteFn(g.IO.LogWriteUserData, g.LogFilename, g.LogBuffer.c_str(), (size_t)g.LogBuffer.size());
+    g.LogBuffer.Buf.resize(0);
 }
 
 // Helper to display logging buttons
@@ -13188,33 +14081,50 @@ void ImGui::UpdateSettings()
     }
 }
 
+// Mark all handlers as needing to write their data again
 void ImGui::MarkIniSettingsDirty()
 {
     ImGuiContext& g = *GImGui;
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        handler.WantWrite = true;
     if (g.SettingsDirtyTimer <= 0.0f)
         g.SettingsDirtyTimer = g.IO.IniSavingRate;
 }
 
 void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
 {
-    ImGuiContext& g = *GImGui;
     if (!(window->Flags & ImGuiWindowFlags_NoSavedSettings))
-        if (g.SettingsDirtyTimer <= 0.0f)
-            g.SettingsDirtyTimer = g.IO.IniSavingRate;
+        MarkIniSettingsDirty(FindSettingsHandler("Window"));
+}
+
+// Only this handler will call its WriteAllFn()/WriteBinaryFn() on next save, the output of other handlers with WriteOnlyWhenDirty set is reused.
+void ImGui::MarkIniSettingsDirty(ImGuiSettingsHandler* handler)
+{
+    ImGuiContext& g = *GImGui;
+    if (handler == NULL)
+        return MarkIniSettingsDirty();
+    handler->WantWrite = true;
+    if (g.SettingsDirtyTimer <= 0.0f)
+        g.SettingsDirtyTimer = g.IO.IniSavingRate;
 }
 
 void ImGui::AddSettingsHandler(const ImGuiSettingsHandler* handler)
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(FindSettingsHandler(handler->TypeName) == NULL);
+    IM_ASSERT(handler->WriteCache.Buf.Data == NULL);
     g.SettingsHandlers.push_back(*handler);
+    g.SettingsHandlers.back().WantWrite = true;
 }
 
 void ImGui::RemoveSettingsHandler(const char* type_name)
 {
     ImGuiContext& g = *GImGui;
     if (ImGuiSettingsHandler* handler = FindSettingsHandler(type_name))
+    {
+        handler->WriteCache.clear();
         g.SettingsHandlers.erase(handler);
+    }
 }
 
 ImGuiSettingsHandler* ImGui::FindSettingsHandler(const char* type_name)
@@ -13233,8 +14143,11 @@ void ImGui::ClearIniSettings()
     ImGuiContext& g = *GImGui;
     g.SettingsIniData.clear();
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+    {
         if (handler.ClearAllFn != NULL)
             handler.ClearAllFn(&g, &handler);
+        handler.WantWrite = true;
+    }
 }
 
 void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
@@ -13248,31 +14161,28 @@ void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
     IM_FREE(file_data);
 }
 
-// Zero-tolerance, no error reporting, cheap .ini parsing
-// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
-void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+// Binary settings layout (see io.IniSavingBinary):
+// - Header: IMGUI_SETTINGS_BINARY_MAGIC (8 bytes), ImU32 version.
+// - For each handler: ImU32 TypeHash, ImU32 flags (ImGuiSettingsBinarySectionFlags_), ImU32 payload size, payload.
+//   The payload is the output of WriteBinaryFn() when available, otherwise regular .ini text from WriteAllFn().
+// Data is stored with native endianness and layout. Data with a different version is ignored: bump the version when changing built-in payloads.
+#define IMGUI_SETTINGS_BINARY_MAGIC         "ImGuiBin"
+#define IMGUI_SETTINGS_BINARY_VERSION       1
+enum ImGuiSettingsBinarySectionFlags_
 {
-    ImGuiContext& g = *GImGui;
-    IM_ASSERT(g.Initialized);
-    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
-    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
-
-    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
-    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
-    if (ini_size == 0)
-        ini_size = strlen(ini_data);
-    g.SettingsIniData.Buf.resize((int)ini_size + 1);
-    char* const buf = g.SettingsIniData.Buf.Data;
-    char* const buf_end = buf + ini_size;
-    memcpy(buf, ini_data, ini_size);
-    buf_end[0] = 0;
+    ImGuiSettingsBinarySectionFlags_None    = 0,
+    ImGuiSettingsBinarySectionFlags_Binary  = 1 << 0,   // Payload was written by WriteBinaryFn()
+};
 
-    // Call pre-read handlers
-    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
-    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-        if (handler.ReadInitFn != NULL)
-            handler.ReadInitFn(&g, &handler);
+static bool IsIniSettingsDataBinary(const char* ini_data, size_t ini_size)
+{
+    return ini_size >= 8 + sizeof(ImU32) && memcmp(ini_data, IMGUI_SETTINGS_BINARY_MAGIC, 8) == 0;
+}
 
+// Parse .ini text in place. Writes zero-terminators within the [buf, buf_end] range (included).
+static void LoadIniSettingsFromText(ImGuiContext* ctx, char* const buf, char* const buf_end)
+{
+    ImGuiContext& g = *ctx;
     void* entry_data = NULL;
     ImGuiSettingsHandler* entry_handler = NULL;
 
@@ -13300,7 +14210,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
                 continue;
             *type_end = 0; // Overwrite first ']'
             name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
+            entry_handler = ImGui::FindSettingsHandler(type_start);
             entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
         }
         else if (entry_handler != NULL && entry_data != NULL)
@@ -13309,15 +14219,99 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
         }
     }
+}
+
+static void LoadIniSettingsFromBinary(ImGuiContext* ctx, char* const buf, char* const buf_end)
+{
+    ImGuiContext& g = *ctx;
+    for (char* p = buf + 8 + sizeof(ImU32); p + sizeof(ImU32) * 3 <= buf_end; )
+    {
+        ImU32 section_header[3]; // TypeHash, Flags, Size
+        memcpy(section_header, p, sizeof(section_header));
+        char* payload = p + sizeof(section_header);
+        if (section_header[2] > (size_t)(buf_end - payload))
+            break; // Truncated
+        char* payload_end = payload + section_header[2];
+        p = payload_end;
+
+        ImGuiSettingsHandler* handler = NULL;
+        for (ImGuiSettingsHandler& handler_candidate : g.SettingsHandlers)
+            if (handler_candidate.TypeHash == section_header[0])
+                handler = &handler_candidate;
+        if (handler == NULL)
+            continue;
+        if (section_header[1] & ImGuiSettingsBinarySectionFlags_Binary)
+        {
+            if (handler->ReadBinaryFn != NULL)
+                handler->ReadBinaryFn(&g, handler, payload, section_header[2]);
+        }
+        else
+        {
+            // Text parser writes a zero-terminator at payload_end, which is the start of next section.
+            const char backup_c = payload_end[0];
+            LoadIniSettingsFromText(&g, payload, payload_end);
+            payload_end[0] = backup_c;
+        }
+    }
+}
+
+// Zero-tolerance, no error reporting, cheap .ini parsing
+// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
+// Binary data written with io.IniSavingBinary is automatically detected (ini_size needs to be provided).
+void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+{
+    IMGUI_DEBUG_ALLOC_SITE("Settings");
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
+    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+
+    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
+    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    if (ini_size == 0)
+        ini_size = strlen(ini_data);
+    const bool is_binary = IsIniSettingsDataBinary(ini_data, ini_size);
+    if (is_binary)
+    {
+        ImU32 version = 0;
+        memcpy(&version, ini_data + 8, sizeof(ImU32));
+        if (version != IMGUI_SETTINGS_BINARY_VERSION)
+        {
+            IMGUI_DEBUG_LOG("LoadIniSettingsFromMemory(): ignoring binary settings with version %u (expected %d).\n", version, IMGUI_SETTINGS_BINARY_VERSION);
+            g.SettingsLoaded = true;
+            return;
+        }
+    }
+    g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    g.SettingsIniDataBinary = is_binary;
+    char* const buf = g.SettingsIniData.Buf.Data;
+    char* const buf_end = buf + ini_size;
+    memcpy(buf, ini_data, ini_size);
+    buf_end[0] = 0;
+
+    // Call pre-read handlers
+    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ReadInitFn != NULL)
+            handler.ReadInitFn(&g, &handler);
+
+    if (is_binary)
+        LoadIniSettingsFromBinary(&g, buf, buf_end);
+    else
+        LoadIniSettingsFromText(&g, buf, buf_end);
     g.SettingsLoaded = true;
 
     // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
     memcpy(buf, ini_data, ini_size);
 
     // Call post-read handlers
+    // Loaded data is not reflected in the output of the previous save anymore.
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+    {
         if (handler.ApplyAllFn != NULL)
             handler.ApplyAllFn(&g, &handler);
+        handler.WantWrite = true;
+    }
 }
 
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
@@ -13329,7 +14323,19 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
+
+    // Let user perform the write (e.g. on a worker thread) from a copy which stays untouched until their next call returns.
+    if (g.IO.WriteIniSettingsFn != NULL)
+    {
+        g.SettingsWriteSnapshotIdx ^= 1;
+        ImVector<char>& snapshot = g.SettingsWriteSnapshot[g.SettingsWriteSnapshotIdx];
+        snapshot.resize((int)ini_data_size + 1);
+        memcpy(snapshot.Data, ini_data, ini_data_size + 1);
+        g.IO.WriteIniSettingsFn(g.IO.WriteIniSettingsUserData, ini_filename, snapshot.Data, ini_data_size);
+        return;
+    }
+
+    ImFileHandle f = ImFileOpen(ini_filename, g.SettingsIniDataBinary ? "wb" : "wt");
     if (!f)
         return;
     ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
@@ -13337,14 +14343,54 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+// Handlers with WriteOnlyWhenDirty set are only called when marked with MarkIniSettingsDirty() since the previous save, otherwise their previous output is reused.
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
+    IMGUI_DEBUG_ALLOC_SITE("Settings");
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
+    const bool is_binary = g.IO.IniSavingBinary;
+    if (g.SettingsIniDataBinary != is_binary)
+        for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+            handler.WantWrite = true;
+    g.SettingsIniDataBinary = is_binary;
+
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
+    if (is_binary)
+    {
+        const ImU32 version = IMGUI_SETTINGS_BINARY_VERSION;
+        g.SettingsIniData.append(IMGUI_SETTINGS_BINARY_MAGIC, IMGUI_SETTINGS_BINARY_MAGIC + 8);
+        g.SettingsIniData.append((const char*)&version, (const char*)(&version + 1));
+    }
     for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-        handler.WriteAllFn(&g, &handler, &g.SettingsIniData);
+    {
+        const bool use_write_binary_fn = is_binary && handler.WriteBinaryFn != NULL;
+        const int section_offset = g.SettingsIniData.size();
+        if (is_binary)
+        {
+            const ImU32 section_header[3] = { handler.TypeHash, (ImU32)(use_write_binary_fn ? ImGuiSettingsBinarySectionFlags_Binary : ImGuiSettingsBinarySectionFlags_None), 0 }; // Size is patched below
+            g.SettingsIniData.append((const char*)section_header, (const char*)(section_header + 3));
+        }
+        ImGuiTextBuffer* out_buf = handler.WriteOnlyWhenDirty ? &handler.WriteCache : &g.SettingsIniData;
+        if (handler.WantWrite || !handler.WriteOnlyWhenDirty || g.IO.ConfigDebugIniSettings)
+        {
+            if (handler.WriteOnlyWhenDirty)
+                handler.WriteCache.Buf.resize(0);
+            if (use_write_binary_fn)
+                handler.WriteBinaryFn(&g, &handler, out_buf);
+            else
+                handler.WriteAllFn(&g, &handler, out_buf);
+            handler.WantWrite = false;
+        }
+        if (handler.WriteOnlyWhenDirty)
+            g.SettingsIniData.append(handler.WriteCache.begin(), handler.WriteCache.end());
+        if (is_binary)
+        {
+            const ImU32 section_size = (ImU32)(g.SettingsIniData.size() - section_offset - (int)sizeof(ImU32) * 3);
+            memcpy(g.SettingsIniData.Buf.Data + section_offset + sizeof(ImU32) * 2, &section_size, sizeof(section_size));
+        }
+    }
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
     return g.SettingsIniData.c_str();
@@ -13369,6 +14415,8 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
+    if (settings->ID != 0)
+        g.SettingsWindowsIndex.SetOffset(settings->ID, g.SettingsWindows.offset_from_ptr(settings));
 
     return settings;
 }
@@ -13378,7 +14426,15 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 ImGuiWindowSettings* ImGui::FindWindowSettingsByID(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    const int offset = g.SettingsWindowsIndex.GetOffset(id);
+    if (offset == -1)
+        return NULL;
+    ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset);
+    if (!settings->WantDelete)
+        return settings;
+
+    // Most recent entry was deleted by ClearWindowSettings(): an older entry may have been revived
+    for (settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
         if (settings->ID == id && !settings->WantDelete)
             return settings;
     return NULL;
@@ -13405,6 +14461,8 @@ void ImGui::ClearWindowSettings(const char* name)
     }
     if (ImGuiWindowSettings* settings = window ? FindWindowSettingsByWindow(window) : FindWindowSettingsByID(ImHashStr(name)))
         settings->WantDelete = true;
+    if (ImGuiSettingsHandler* handler = FindSettingsHandler("Window"))
+        handler->WantWrite = true;
 }
 
 static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
@@ -13413,6 +14471,8 @@ static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (ImGuiWindow* window : g.Windows)
         window->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsIndex.Clear();
+    g.SettingsWindowsTextCache.Buf.resize(0);
 }
 
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
@@ -13452,10 +14512,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_GatherAll(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (ImGuiWindow* window : g.Windows)
     {
@@ -13469,34 +14529,119 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih(window->Pos);
-        settings->Size = ImVec2ih(window->SizeFull);
-        settings->IsChild = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
+        const ImVec2ih pos(window->Pos);
+        const ImVec2ih size(window->SizeFull);
+        const bool is_child = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
+        if (settings->Pos.x != pos.x || settings->Pos.y != pos.y || settings->Size.x != size.x || settings->Size.y != size.y || settings->IsChild != is_child || settings->Collapsed != window->Collapsed || settings->WantDelete)
+            settings->WantWrite = true;
+        settings->Pos = pos;
+        settings->Size = size;
+        settings->IsChild = is_child;
         settings->Collapsed = window->Collapsed;
         settings->WantDelete = false;
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
 
     // Write to text buffer
-    buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
+    // Only entries which changed since the last text save are formatted, the text of others is copied from that save.
+    ImGuiTextBuffer* prev_buf = &g.SettingsWindowsTextCache;
+    ImGuiTextBuffer* next_buf = &g.SettingsWindowsTextCacheNext;
+    next_buf->Buf.resize(0);
+    next_buf->reserve(ImMax(prev_buf->size(), g.SettingsWindows.size() * 6)); // ballpark reserve
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
         if (settings->WantDelete)
+        {
+            settings->WantWrite = true; // Not in the next text cache
             continue;
-        const char* settings_name = settings->GetName();
-        buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
-        if (settings->IsChild)
+        }
+        const int entry_offset = next_buf->size();
+        if (!settings->WantWrite)
         {
-            buf->appendf("IsChild=1\n");
-            buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+            next_buf->append(prev_buf->begin() + settings->TextCacheOffset, prev_buf->begin() + settings->TextCacheOffset + settings->TextCacheSize);
         }
         else
         {
-            buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
-            buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
-            if (settings->Collapsed)
-                buf->appendf("Collapsed=1\n");
+            const char* settings_name = settings->GetName();
+            next_buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
+            if (settings->IsChild)
+            {
+                next_buf->appendf("IsChild=1\n");
+                next_buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+            }
+            else
+            {
+                next_buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
+                next_buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+                if (settings->Collapsed)
+                    next_buf->appendf("Collapsed=1\n");
+            }
+            next_buf->append("\n");
+            settings->WantWrite = false;
         }
-        buf->append("\n");
+        settings->TextCacheOffset = entry_offset;
+        settings->TextCacheSize = next_buf->size() - entry_offset;
+    }
+    buf->append(next_buf->begin(), next_buf->end());
+    prev_buf->Buf.swap(next_buf->Buf);
+}
+
+// Binary entry, followed by NameSize bytes of zero-terminated name. Bump IMGUI_SETTINGS_BINARY_VERSION when changing.
+struct ImGuiWindowSettingsBinaryEntry
+{
+    ImVec2ih    Pos;
+    ImVec2ih    Size;
+    ImU16       NameSize;   // Including zero-terminator
+    ImU8        IsChild;
+    ImU8        Collapsed;
+};
+
+static void WindowSettingsHandler_ReadBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const char* data, size_t data_size)
+{
+    const char* data_end = data + data_size;
+    ImGuiWindowSettingsBinaryEntry entry;
+    while ((size_t)(data_end - data) >= sizeof(entry))
+    {
+        memcpy(&entry, data, sizeof(entry));
+        const char* name = data + sizeof(entry);
+        if (entry.NameSize == 0 || entry.NameSize > (size_t)(data_end - name) || name[entry.NameSize - 1] != 0)
+            break;
+        data = name + entry.NameSize;
+        ImGuiWindowSettings* settings = (ImGuiWindowSettings*)WindowSettingsHandler_ReadOpen(ctx, handler, name);
+        settings->Pos = entry.Pos;
+        settings->Size = entry.Size;
+        settings->IsChild = entry.IsChild != 0;
+        settings->Collapsed = entry.Collapsed != 0;
+    }
+}
+
+static void WindowSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
+
+    buf->reserve(buf->size() + g.SettingsWindows.size());
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        if (settings->WantDelete)
+            continue;
+        const char* settings_name = settings->GetName();
+        const size_t name_size = strlen(settings_name) + 1;
+        if (name_size > 0xFFFF)
+            continue;
+        ImGuiWindowSettingsBinaryEntry entry;
+        entry.Pos = settings->Pos;
+        entry.Size = settings->Size;
+        entry.NameSize = (ImU16)name_size;
+        entry.IsChild = settings->IsChild ? 1 : 0;
+        entry.Collapsed = settings->Collapsed ? 1 : 0;
+        buf->append((const char*)&entry, (const char*)(&entry + 1));
+        buf->append(settings_name, settings_name + name_size);
     }
 }
 
@@ -13684,7 +14829,7 @@ static const char* GetClipboardTextFn_DefaultImpl(void* user_data_ctx)
 static void SetClipboardTextFn_DefaultImpl(void* user_data_ctx, const char* text)
 {
     ImGuiContext& g = *(ImGuiContext*)user_data_ctx;
-    g.ClipboardHandlerData.clear();
+    g.ClipboardHandlerData.resize(0); // Keep capacity: copying repeatedly shouldn't allocate
     const char* text_end = text + strlen(text);
     g.ClipboardHandlerData.resize((int)(text_end - text) + 1);
     memcpy(&g.ClipboardHandlerData[0], text, (size_t)(text_end - text));
@@ -13731,6 +14876,112 @@ static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeDat
 
 #endif
 
+//-----------------------------------------------------------------------------
+// [SECTION] FRAME PROFILER
+//-----------------------------------------------------------------------------
+// Compiled only when IMGUI_ENABLE_PROFILER is defined. Instrument code with IMGUI_PROFILE_SCOPE() or IMGUI_PROFILE_ZONE_BEGIN()/IMGUI_PROFILE_ZONE_END().
+// Zones are recorded in a ring buffer of IMGUI_PROFILER_FRAMES frames and displayed in Metrics->Profiler.
+// Use ProfilerSetHook() to forward zones to an external profiler.
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+ImU64 ImGui::ProfilerGetTimeNs()
+{
+    return ImGetTimeNs();
+}
+
+// Called at the beginning of NewFrame(): close frame being recorded (if any) and start recording a new one
+void ImGui::ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    const ImU64 time = ProfilerGetTimeNs();
+    if (profiler->FrameIdx != -1)
+        profiler->Frames[profiler->FrameIdx].TimeEnd = time;
+
+    // Zones left open across frames (e.g. user zone around NewFrame() call) are not recorded in the new frame
+    for (ImGuiProfilerStackEntry& entry : profiler->ZoneStack)
+        entry.ZoneIdx = -1;
+
+    if (profiler->Paused)
+    {
+        profiler->FrameIdx = -1;
+        return;
+    }
+    profiler->FrameIdx = g.FrameCount % IMGUI_PROFILER_FRAMES;
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+    frame->FrameCount = g.FrameCount;
+    frame->TimeBegin = time;
+    frame->TimeEnd = 0;
+    frame->Zones.resize(0);
+    frame->Names.Buf.resize(0);
+}
+
+void ImGui::ProfilerZoneBegin(const char* name)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (profiler->HookCallback)
+        profiler->HookCallback(&g, name, true, profiler->HookUserData);
+
+    int zone_idx = -1;
+    if (profiler->FrameIdx != -1)
+    {
+        ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+        if (frame->Zones.Size < IMGUI_PROFILER_ZONES_MAX)
+        {
+            zone_idx = frame->Zones.Size;
+            frame->Zones.resize(frame->Zones.Size + 1);
+            ImGuiProfilerZone* zone = &frame->Zones[zone_idx];
+            zone->NameOffset = frame->Names.size();
+            frame->Names.append(name, name + strlen(name) + 1);
+            zone->TimeBegin = ProfilerGetTimeNs();
+            zone->TimeEnd = 0;
+            zone->Depth = profiler->ZoneStack.Size;
+        }
+    }
+    ImGuiProfilerStackEntry entry;
+    entry.NameOffset = profiler->ZoneStackNames.size();
+    entry.ZoneIdx = zone_idx;
+    profiler->ZoneStack.push_back(entry);
+    profiler->ZoneStackNames.append(name, name + strlen(name) + 1);
+}
+
+void ImGui::ProfilerZoneEnd()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    IM_ASSERT(profiler->ZoneStack.Size > 0 && "Mismatched ProfilerZoneBegin()/ProfilerZoneEnd() calls!");
+    const ImGuiProfilerStackEntry entry = profiler->ZoneStack.back();
+    profiler->ZoneStack.pop_back();
+    if (entry.ZoneIdx != -1)
+        profiler->Frames[profiler->FrameIdx].Zones[entry.ZoneIdx].TimeEnd = ProfilerGetTimeNs();
+    if (profiler->HookCallback)
+        profiler->HookCallback(&g, profiler->ZoneStackNames.Buf.Data + entry.NameOffset, false, profiler->HookUserData);
+    profiler->ZoneStackNames.Buf.resize(entry.NameOffset + 1);
+    profiler->ZoneStackNames.Buf[entry.NameOffset] = 0;
+}
+
+void ImGui::ProfilerSetHook(ImGuiProfilerHookCallback callback, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    g.Profiler.HookCallback = callback;
+    g.Profiler.HookUserData = user_data;
+}
+
+ImGuiProfilerScope::ImGuiProfilerScope(const char* name)
+{
+    ImGui::ProfilerZoneBegin(name);
+}
+
+ImGuiProfilerScope::~ImGuiProfilerScope()
+{
+    ImGui::ProfilerZoneEnd();
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -13946,6 +15197,14 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
+    {
+        ImGuiMemoryUsage gc_usage;
+        GcCalcMemoryUsage(&gc_usage);
+        if (io.ConfigMemoryCompactBudget != 0)
+            Text("Transient buffers: %.1f KB used, %.1f KB retained (budget: %.1f KB)", gc_usage.UsedBytes / 1024.0f, gc_usage.RetainedBytes / 1024.0f, io.ConfigMemoryCompactBudget / 1024.0f);
+        else
+            Text("Transient buffers: %.1f KB used, %.1f KB retained (no budget)", gc_usage.UsedBytes / 1024.0f, gc_usage.RetainedBytes / 1024.0f);
+    }
 
     Separator();
 
@@ -14004,9 +15263,9 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         MetricsHelpMarker("You can also call ImGui::DebugTextEncoding() from your code with a given string to test that your UTF-8 encoding settings are correct.");
         if (show_encoding_viewer)
         {
-            static char buf[100] = "";
+            char* buf = cfg->EncodingViewerBuf;
             SetNextItemWidth(-FLT_MIN);
-            InputText("##Text", buf, IM_ARRAYSIZE(buf));
+            InputText("##Text", buf, IM_ARRAYSIZE(cfg->EncodingViewerBuf));
             if (buf[0] != 0)
                 DebugTextEncoding(buf);
             TreePop();
@@ -14127,6 +15386,16 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     {
         Checkbox("Show ImDrawCmd mesh when hovering", &cfg->ShowDrawCmdMesh);
         Checkbox("Show ImDrawCmd bounding boxes when hovering", &cfg->ShowDrawCmdBoundingBoxes);
+        Checkbox("Cache bezier curves (io.ConfigDrawListCurveCache)", &g.IO.ConfigDrawListCurveCache);
+        if (g.IO.ConfigDrawListCurveCache)
+            BulletText("Curve cache: %d curves, %d points", g.DrawListSharedData.CurveCache.Entries.Size, g.DrawListSharedData.CurveCache.Points.Size);
+        Checkbox("Merge draw lists (io.ConfigDrawDataMerge)", &g.IO.ConfigDrawDataMerge);
+        if (g.IO.ConfigDrawDataMerge)
+            for (int viewport_n = 0; viewport_n < g.Viewports.Size; viewport_n++)
+            {
+                ImGuiViewportP* viewport = g.Viewports[viewport_n];
+                BulletText("Viewport #%d: %d draw lists, %d cmds -> %d draw list, %d cmds", viewport_n, viewport->DrawDataMergeListsCount, viewport->DrawDataMergeCmdsCount[0], viewport->DrawDataP.CmdListsCount, viewport->DrawDataMergeCmdsCount[1]);
+            }
         for (ImGuiViewportP* viewport : g.Viewports)
             for (ImDrawList* draw_list : viewport->DrawDataP.CmdLists)
                 DebugNodeDrawList(NULL, viewport, draw_list, "DrawList");
@@ -14227,11 +15496,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         else
             TextUnformatted("<NULL>");
         Checkbox("io.ConfigDebugIniSettings", &io.ConfigDebugIniSettings);
+        Checkbox("io.IniSavingBinary", &io.IniSavingBinary);
         Text("SettingsDirtyTimer %.2f", g.SettingsDirtyTimer);
         if (TreeNode("SettingsHandlers", "Settings handlers: (%d)", g.SettingsHandlers.Size))
         {
             for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
-                BulletText("\"%s\"", handler.TypeName);
+                if (handler.WriteOnlyWhenDirty)
+                    BulletText("\"%s\": cached output %d bytes%s", handler.TypeName, handler.WriteCache.size(), handler.WantWrite ? " (dirty)" : "");
+                else
+                    BulletText("\"%s\": written on every save", handler.TypeName);
             TreePop();
         }
         if (TreeNode("SettingsWindows", "Settings packed data: Windows: %d bytes", g.SettingsWindows.size()))
@@ -14251,7 +15524,11 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 #ifdef IMGUI_HAS_DOCK
 #endif // #ifdef IMGUI_HAS_DOCK
 
-        if (TreeNode("SettingsIniData", "Settings unpacked data (.ini): %d bytes", g.SettingsIniData.size()))
+        if (g.SettingsIniDataBinary)
+        {
+            BulletText("Settings unpacked data (binary): %d bytes", g.SettingsIniData.size());
+        }
+        else if (TreeNode("SettingsIniData", "Settings unpacked data (.ini): %d bytes", g.SettingsIniData.size()))
         {
             InputTextMultiline("##Ini", (char*)(void*)g.SettingsIniData.c_str(), g.SettingsIniData.Buf.Size, ImVec2(-FLT_MIN, GetTextLineHeight() * 20), ImGuiInputTextFlags_ReadOnly);
             TreePop();
@@ -14271,6 +15548,22 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGuiDebugAllocEntry* entry = &info->LastEntriesBuf[(info->LastEntriesIdx - n + buf_size) % buf_size];
             BulletText("Frame %06d: %+3d ( %2d malloc, %2d free )%s", entry->FrameCount, entry->AllocCount - entry->FreeCount, entry->AllocCount, entry->FreeCount, (n == 0) ? " (most recent)" : "");
         }
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+        DebugNodeAllocSites(info);
+#else
+        TextDisabled("Define IMGUI_DEBUG_ALLOC_SITES in imconfig.h to attribute allocations to call sites.");
+#endif
+        TreePop();
+    }
+
+    // Profiler
+    if (TreeNode("Profiler"))
+    {
+#ifdef IMGUI_ENABLE_PROFILER
+        DebugNodeProfiler(&g.Profiler);
+#else
+        TextDisabled("Define IMGUI_ENABLE_PROFILER in imconfig.h to record frame zones.");
+#endif
         TreePop();
     }
 
@@ -14315,6 +15608,19 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             Unindent();
         }
 
+        Text("INPUT EVENTS QUEUE");
+        {
+            Indent();
+            ImGuiInputEventsStats* stats = &g.InputEventsStats;
+            Text("Queue: %d / %d events (trickle: %d, coalesce: %d)", g.InputEventsQueue.Size, g.InputEventsQueue.capacity(), io.ConfigInputTrickleEventQueue, io.ConfigInputCoalesceEvents);
+            Text("Processed last frame: %d, Trail: %d", stats->ProcessedCount, g.InputEventsTrail.Size);
+            Text("Coalesced: %d last frame, %d total", stats->CoalescedCount, stats->CoalescedCountTotal);
+            Text("Latency: last %.2f ms, avg %.2f ms, peak %.2f ms", stats->LatencyLast * 1000.0f, stats->LatencyAvg * 1000.0f, stats->LatencyPeak * 1000.0f);
+            SameLine(); MetricsHelpMarker("Measured as the time between submission of an input event (io.AddXXXEvent() call) and its processing by NewFrame().\nEvents trickled over multiple frames will show higher latency.");
+            SameLine(); if (SmallButton("Reset")) stats->LatencyPeak = 0.0f;
+            Unindent();
+        }
+
         Text("MOUSE WHEELING");
         {
             Indent();
@@ -14476,6 +15782,14 @@ void ImGui::DebugNodeColumns(ImGuiOldColumns* columns)
     TreePop();
 }
 
+// Vertex index of the n-th element of a draw list, which may use 16-bit indices, 32-bit indices (IdxBuffer32) or no indices
+static unsigned int DebugDrawListGetIndex(const ImDrawList* draw_list, unsigned int idx_n)
+{
+    if (draw_list->IdxBuffer32.Size > 0)
+        return draw_list->IdxBuffer32.Data[idx_n];
+    return (draw_list->IdxBuffer.Size > 0) ? (unsigned int)draw_list->IdxBuffer.Data[idx_n] : idx_n;
+}
+
 // [DEBUG] Display contents of ImDrawList
 void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, const ImDrawList* draw_list, const char* label)
 {
@@ -14485,7 +15799,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     int cmd_count = draw_list->CmdBuffer.Size;
     if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices%s, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->GetIdxCount(), draw_list->IdxBuffer32.Size > 0 ? " (32-bit)" : "", cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -14513,9 +15827,9 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         }
 
         char buf[300];
-        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex 0x%p, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex 0x%p, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)%s",
             pcmd->ElemCount / 3, (void*)(intptr_t)pcmd->TextureId,
-            pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+            pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w, (pcmd->Flags & ImDrawCmdFlags_SDF) ? ", SDF" : "");
         bool pcmd_node_open = TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf);
         if (IsItemHovered() && (cfg->ShowDrawCmdMesh || cfg->ShowDrawCmdBoundingBoxes) && fg_draw_list)
             DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, cfg->ShowDrawCmdMesh, cfg->ShowDrawCmdBoundingBoxes);
@@ -14524,14 +15838,13 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
 
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
-        const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
         float total_area = 0.0f;
         for (unsigned int idx_n = pcmd->IdxOffset; idx_n < pcmd->IdxOffset + pcmd->ElemCount; )
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = vtx_buffer[DebugDrawListGetIndex(draw_list, idx_n)].pos;
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -14551,10 +15864,11 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 ImVec2 triangle[3];
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
-                    const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImDrawVert& v = vtx_buffer[DebugDrawListGetIndex(draw_list, (unsigned int)idx_i)];
+                    const ImVec2 uv = v.uv;
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -14583,12 +15897,11 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     out_draw_list->Flags &= ~ImDrawListFlags_AntiAliasedLines; // Disable AA on triangle outlines is more readable for very large and thin triangles.
     for (unsigned int idx_n = draw_cmd->IdxOffset, idx_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; idx_n < idx_end; )
     {
-        ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
-        ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset;
+        ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset; // We don't hold on this pointer past iterations as ->AddPolyline() may invalidate it if out_draw_list==draw_list
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = vtx_buffer[DebugDrawListGetIndex(draw_list, idx_n)].pos));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -14601,6 +15914,173 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     out_draw_list->Flags = backup_flags;
 }
 
+#ifdef IMGUI_ENABLE_PROFILER
+// [DEBUG] Display recorded frames of the frame profiler: timeline of zones + zones aggregated by name
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    // Collect complete frames, most recent first
+    int frames_idx[IMGUI_PROFILER_FRAMES];
+    int frames_count = 0;
+    for (int n = 0; n < IMGUI_PROFILER_FRAMES; n++)
+    {
+        const ImGuiProfilerFrame* frame = &profiler->Frames[n];
+        if (frame->FrameCount == -1 || frame->TimeEnd == 0)
+            continue;
+        int insert_n = frames_count++;
+        for (; insert_n > 0 && profiler->Frames[frames_idx[insert_n - 1]].FrameCount < frame->FrameCount; insert_n--)
+            frames_idx[insert_n] = frames_idx[insert_n - 1];
+        frames_idx[insert_n] = n;
+    }
+
+    Checkbox("Pause", &profiler->Paused);
+    if (frames_count == 0)
+    {
+        TextDisabled("No frame recorded.");
+        return;
+    }
+    SameLine();
+    SetNextItemWidth(GetFontSize() * 10.0f);
+    SliderInt("Frame offset", &profiler->DisplayFrameOffset, 0, frames_count - 1);
+    profiler->DisplayFrameOffset = ImClamp(profiler->DisplayFrameOffset, 0, frames_count - 1);
+    const ImGuiProfilerFrame* frame = &profiler->Frames[frames_idx[profiler->DisplayFrameOffset]];
+    const double frame_duration = (double)(frame->TimeEnd - frame->TimeBegin);
+    Text("Frame %d: %.3f ms, %d zones%s", frame->FrameCount, frame_duration / 1000000.0, frame->Zones.Size, (frame->Zones.Size >= IMGUI_PROFILER_ZONES_MAX) ? " (truncated)" : "");
+
+    // Timeline/flame view
+    int max_depth = 0;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+        max_depth = ImMax(max_depth, zone.Depth);
+    const float row_height = GetTextLineHeight() + 2.0f;
+    const ImVec2 timeline_pos = GetCursorScreenPos();
+    const ImVec2 timeline_size(ImMax(GetContentRegionAvail().x, 100.0f), row_height * (max_depth + 1));
+    InvisibleButton("##timeline", timeline_size);
+    const bool timeline_hovered = IsItemHovered();
+    ImDrawList* draw_list = GetWindowDrawList();
+    draw_list->AddRectFilled(timeline_pos, timeline_pos + timeline_size, GetColorU32(ImGuiCol_FrameBg));
+    const double scale = (frame_duration > 0.0) ? timeline_size.x / frame_duration : 0.0;
+    const ImGuiProfilerZone* hovered_zone = NULL;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+    {
+        const ImU64 zone_end = (zone.TimeEnd != 0) ? zone.TimeEnd : frame->TimeEnd;
+        const float x0 = timeline_pos.x + (float)((double)(zone.TimeBegin - frame->TimeBegin) * scale);
+        const float x1 = ImMax(timeline_pos.x + (float)((double)(zone_end - frame->TimeBegin) * scale), x0 + 1.0f);
+        const float y0 = timeline_pos.y + zone.Depth * row_height;
+        const ImRect zone_bb(x0, y0, x1, y0 + row_height - 1.0f);
+        float r, g, b;
+        const char* zone_name = frame->GetZoneName(zone);
+        ColorConvertHSVtoRGB((float)(ImHashStr(zone_name) & 0xFF) / 255.0f, 0.45f, 0.75f, r, g, b);
+        draw_list->AddRectFilled(zone_bb.Min, zone_bb.Max, GetColorU32(ImVec4(r, g, b, 1.0f)));
+        if (zone_bb.GetWidth() > GetFontSize())
+        {
+            draw_list->PushClipRect(zone_bb.Min, zone_bb.Max, true);
+            draw_list->AddText(zone_bb.Min + ImVec2(2.0f, 1.0f), IM_COL32_BLACK, zone_name);
+            draw_list->PopClipRect();
+        }
+        if (timeline_hovered && zone_bb.Contains(GetIO().MousePos))
+            hovered_zone = &zone;
+    }
+    if (hovered_zone != NULL)
+    {
+        const ImU64 zone_end = (hovered_zone->TimeEnd != 0) ? hovered_zone->TimeEnd : frame->TimeEnd;
+        const double zone_duration = (double)(zone_end - hovered_zone->TimeBegin);
+        SetTooltip("%s\n%.3f ms (%.1f%% of frame)\nStart: +%.3f ms, Depth: %d", frame->GetZoneName(*hovered_zone), zone_duration / 1000000.0, 100.0 * zone_duration / frame_duration, (double)(hovered_zone->TimeBegin - frame->TimeBegin) / 1000000.0, hovered_zone->Depth);
+    }
+
+    // Zones aggregated by name
+    struct ZoneSummary { const char* Name; int Count; double Duration; };
+    struct Func { static int IMGUI_CDECL SummaryComparer(const void* lhs, const void* rhs) { const double d = ((const ZoneSummary*)rhs)->Duration - ((const ZoneSummary*)lhs)->Duration; return (d > 0.0) ? +1 : (d < 0.0) ? -1 : 0; } };
+    ImVector<ZoneSummary> summaries;
+    ImGuiStorage summaries_map;
+    for (const ImGuiProfilerZone& zone : frame->Zones)
+    {
+        const char* zone_name = frame->GetZoneName(zone);
+        int* p_idx = summaries_map.GetIntRef(ImHashStr(zone_name), -1);
+        if (*p_idx == -1)
+        {
+            *p_idx = summaries.Size;
+            ZoneSummary summary = { zone_name, 0, 0.0 };
+            summaries.push_back(summary);
+        }
+        ZoneSummary* summary = &summaries[*p_idx];
+        summary->Count++;
+        summary->Duration += (double)(((zone.TimeEnd != 0) ? zone.TimeEnd : frame->TimeEnd) - zone.TimeBegin);
+    }
+    ImQsort(summaries.Data, (size_t)summaries.Size, sizeof(ZoneSummary), Func::SummaryComparer);
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+    if (!BeginTable("##zones", 4, table_flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 12)))
+        return;
+    TableSetupScrollFreeze(0, 1);
+    TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+    TableSetupColumn("Count");
+    TableSetupColumn("Total (ms)");
+    TableSetupColumn("% Frame");
+    TableHeadersRow();
+    for (const ZoneSummary& summary : summaries)
+    {
+        TableNextRow();
+        TableNextColumn(); TextUnformatted(summary.Name);
+        TableNextColumn(); Text("%d", summary.Count);
+        TableNextColumn(); Text("%.3f", summary.Duration / 1000000.0);
+        TableNextColumn(); Text("%.1f%%", (frame_duration > 0.0) ? 100.0 * summary.Duration / frame_duration : 0.0);
+    }
+    EndTable();
+}
+#endif
+
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+// [DEBUG] Display allocation sites, sorted by number of allocations over the sliding window
+void ImGui::DebugNodeAllocSites(ImGuiDebugAllocInfo* info)
+{
+    ImGuiContext& g = *GImGui;
+    struct SiteSummary { const ImGuiDebugAllocSite* Site; int WindowCount; size_t WindowBytes; };
+    struct Func { static int IMGUI_CDECL SummaryComparer(const void* lhs, const void* rhs) { const SiteSummary* a = (const SiteSummary*)lhs; const SiteSummary* b = (const SiteSummary*)rhs; if (a->WindowCount != b->WindowCount) return b->WindowCount - a->WindowCount; return (a->WindowBytes < b->WindowBytes) ? +1 : (a->WindowBytes > b->WindowBytes) ? -1 : 0; } };
+
+    // Only sum slots belonging to the last IMGUI_DEBUG_ALLOC_SITES_FRAMES frames (slots are not cleared on frames without allocations)
+    SiteSummary summaries[IMGUI_DEBUG_ALLOC_SITES_MAX];
+    for (int site_n = 0; site_n < info->SitesCount; site_n++)
+    {
+        SiteSummary* summary = &summaries[site_n];
+        summary->Site = &info->Sites[site_n];
+        summary->WindowCount = 0;
+        summary->WindowBytes = 0;
+        for (int slot = 0; slot < IMGUI_DEBUG_ALLOC_SITES_FRAMES; slot++)
+            if (info->SitesFrameCount[slot] > g.FrameCount - IMGUI_DEBUG_ALLOC_SITES_FRAMES)
+            {
+                summary->WindowCount += summary->Site->AllocCount[slot];
+                summary->WindowBytes += summary->Site->AllocBytes[slot];
+            }
+    }
+    ImQsort(summaries, (size_t)info->SitesCount, sizeof(SiteSummary), Func::SummaryComparer);
+
+    Text("Allocation sites over last %d frames:", IMGUI_DEBUG_ALLOC_SITES_FRAMES);
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+    if (!BeginTable("##allocsites", 5, table_flags, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 12)))
+        return;
+    TableSetupScrollFreeze(0, 1);
+    TableSetupColumn("Site", ImGuiTableColumnFlags_WidthStretch);
+    TableSetupColumn("Allocs");
+    TableSetupColumn("Bytes");
+    TableSetupColumn("Total Allocs");
+    TableSetupColumn("Total Bytes");
+    TableHeadersRow();
+    for (int site_n = 0; site_n < info->SitesCount; site_n++)
+    {
+        const SiteSummary* summary = &summaries[site_n];
+        TableNextRow();
+        if (summary->WindowCount == 0)
+            PushStyleColor(ImGuiCol_Text, GetStyleColorVec4(ImGuiCol_TextDisabled));
+        TableNextColumn(); TextUnformatted(summary->Site->Name);
+        TableNextColumn(); Text("%d", summary->WindowCount);
+        TableNextColumn(); Text("%u", (unsigned int)summary->WindowBytes);
+        TableNextColumn(); Text("%d", summary->Site->TotalAllocCount);
+        TableNextColumn(); Text("%llu", (unsigned long long)summary->Site->TotalAllocBytes);
+        if (summary->WindowCount == 0)
+            PopStyleColor();
+    }
+    EndTable();
+}
+#endif
+
 // [DEBUG] Display details for a single font, called by ShowStyleEditor().
 void ImGui::DebugNodeFont(ImFont* font)
 {
@@ -14635,8 +16115,8 @@ void ImGui::DebugNodeFont(ImFont* font)
     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
         if (font->ConfigData)
             if (const ImFontConfig* cfg = &font->ConfigData[config_i])
-                BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d, Offset: (%.1f,%.1f)",
-                    config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH, cfg->GlyphOffset.x, cfg->GlyphOffset.y);
+                BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d, Offset: (%.1f,%.1f), SDF: %d (padding %d)",
+                    config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH, cfg->GlyphOffset.x, cfg->GlyphOffset.y, cfg->SDF, cfg->SDFPadding);
 
     // Display all glyphs of the fonts in separate pages of 256 characters
     if (TreeNode("Glyphs", "Glyphs (%d)", font->Glyphs.Size))
@@ -14739,6 +16219,9 @@ void ImGui::DebugNodeTabBar(ImGuiTabBar* tab_bar, const char* label)
     }
     if (open)
     {
+        ImGuiMemoryUsage tab_bar_usage;
+        TabBarGcCalcMemoryUsage(tab_bar, &tab_bar_usage);
+        BulletText("Transient buffers: %d bytes used, %d bytes retained", (int)tab_bar_usage.UsedBytes, (int)tab_bar_usage.RetainedBytes);
         for (int tab_n = 0; tab_n < tab_bar->Tabs.Size; tab_n++)
         {
             ImGuiTabItem* tab = &tab_bar->Tabs[tab_n];
@@ -14793,6 +16276,9 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
 
     if (window->MemoryCompacted)
         TextDisabled("Note: some memory buffers have been compacted/freed.");
+    ImGuiMemoryUsage window_usage;
+    GcCalcWindowMemoryUsage(window, &window_usage);
+    BulletText("Transient buffers: %d bytes used, %d bytes retained", (int)window_usage.UsedBytes, (int)window_usage.RetainedBytes);
 
     ImGuiWindowFlags flags = window->Flags;
     DebugNodeDrawList(window, window->Viewport, window->DrawList, "DrawList");
@@ -15250,6 +16736,9 @@ void ImGui::DebugNodeColumns(ImGuiOldColumns*) {}
 void ImGui::DebugNodeDrawList(ImGuiWindow*, ImGuiViewportP*, const ImDrawList*, const char*) {}
 void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList*, const ImDrawCmd*, bool, bool) {}
 void ImGui::DebugNodeFont(ImFont*) {}
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+#endif
 void ImGui::DebugNodeStorage(ImGuiStorage*, const char*) {}
 void ImGui::DebugNodeTabBar(ImGuiTabBar*, const char*) {}
 void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
@@ -38,7 +38,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotLod, Math Operators, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -155,6 +155,7 @@ struct ImGuiListClipper;            // Helper to manually clip large list of ite
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
+struct ImGuiPlotLod;                // Helper to plot very large arrays with PlotLines()/PlotHistogram() (min/max level-of-detail pyramid)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
@@ -185,6 +186,7 @@ typedef int ImGuiTableBgTarget;     // -> enum ImGuiTableBgTarget_   // Enum: A
 // - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
 //   In Visual Studio IDE: CTRL+comma ("Edit.GoToAll") can follow symbols in comments, whereas CTRL+F12 ("Edit.GoToImplementation") cannot.
 //   With Visual Assist installed: ALT+G ("VAssistX.GoToImplementation") can also follow symbols in comments.
+typedef int ImDrawCmdFlags;         // -> enum ImDrawCmdFlags_       // Flags: for ImDrawCmd (render state requested from the renderer backend)
 typedef int ImDrawFlags;            // -> enum ImDrawFlags_          // Flags: for ImDrawList functions
 typedef int ImDrawListFlags;        // -> enum ImDrawListFlags_      // Flags: for ImDrawList instance
 typedef int ImFontAtlasFlags;       // -> enum ImFontAtlasFlags_     // Flags: for ImFontAtlas build
@@ -220,6 +222,7 @@ typedef void* ImTextureID;          // Default: store a pointer or an integer fi
 
 // ImDrawIdx: vertex index. [Compile-time configurable type]
 // - To use 16-bit indices + allow large meshes: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset (recommended).
+// - To use 16-bit indices + 32-bit indices for large meshes only: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasIdx32' and handle ImDrawList::IdxBuffer32.
 // - To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in your imconfig.h file.
 #ifndef ImDrawIdx
 typedef unsigned short ImDrawIdx;   // Default: 16-bit (for maximum compatibility with renderer backends)
@@ -249,6 +252,7 @@ typedef ImWchar16 ImWchar;
 // Callback and functions types
 typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);    // Callback function for ImGui::InputText()
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
+typedef void    (*ImGuiPayloadCallback)(ImGuiPayload* payload, void* user_data); // Callback function for ImGui::SetDragDropPayloadNoCopy()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
 
@@ -288,6 +292,7 @@ namespace ImGui
 {
     // Context creation and access
     // - Each context create its own ImFontAtlas by default. You may instance one yourself and pass it to CreateContext() to share a font atlas between contexts.
+    //   To share it between contexts used from different threads, make it read-only first with ImFontAtlas::SetImmutable().
     // - DLL users: heaps and globals are not shared across DLL boundaries! You will need to call SetCurrentContext() + SetAllocatorFunctions()
     //   for each static/DLL boundary you are calling from. Read "Context and Memory Allocators" section of imgui.cpp for details.
     IMGUI_API ImGuiContext* CreateContext(ImFontAtlas* shared_font_atlas = NULL);
@@ -660,6 +665,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const float* values, int values_count, ImGuiPlotLod* lod, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));     // Very large arrays: each pixel column shows the min/max of its samples. See ImGuiPlotLod.
+    IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, ImGuiPlotLod* lod, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float)); // Very large arrays: each pixel column shows the min/max of its samples. See ImGuiPlotLod.
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -837,6 +844,7 @@ namespace ImGui
     // - An item can be both drag source and drop target.
     IMGUI_API bool          BeginDragDropSource(ImGuiDragDropFlags flags = 0);                                      // call after submitting an item which may be dragged. when this return true, you can call SetDragDropPayload() + EndDragDropSource()
     IMGUI_API bool          SetDragDropPayload(const char* type, const void* data, size_t sz, ImGuiCond cond = 0);  // type is a user defined string of maximum 32 characters. Strings starting with '_' are reserved for dear imgui internal types. Data is copied and held by imgui. Return true when payload has been accepted.
+    IMGUI_API bool          SetDragDropPayloadNoCopy(const char* type, const void* data, size_t sz, ImGuiCond cond = 0, ImGuiPayloadCallback callback = NULL, void* user_data = NULL); // data is NOT copied: it needs to stay valid until the drag and drop ends. Optional 'callback' is called once when a target accepts the payload, it receives 'user_data' and may set payload->Data/DataSize to create data lazily.
     IMGUI_API void          EndDragDropSource();                                                                    // only call EndDragDropSource() if BeginDragDropSource() returns true!
     IMGUI_API bool                  BeginDragDropTarget();                                                          // call after submitting an item that may receive a payload. If this returns true, you can call AcceptDragDropPayload() + EndDragDropTarget()
     IMGUI_API const ImGuiPayload*   AcceptDragDropPayload(const char* type, ImGuiDragDropFlags flags = 0);          // accept contents of a given type. If ImGuiDragDropFlags_AcceptBeforeDelivery is set you can peek into the payload before the mouse button is released.
@@ -956,10 +964,11 @@ namespace ImGui
     // - The disk functions are automatically called if io.IniFilename != NULL (default is "imgui.ini").
     // - Set io.IniFilename to NULL to load/save manually. Read io.WantSaveIniSettings description about handling .ini saving manually.
     // - Important: default value "imgui.ini" is relative to current working dir! Most apps will want to lock this to an absolute path (e.g. same path as executables).
+    // - Set io.IniSavingBinary to save with a compact binary format, set io.WriteIniSettingsFn to perform the file write yourself (e.g. on a worker thread).
     IMGUI_API void          LoadIniSettingsFromDisk(const char* ini_filename);                  // call after CreateContext() and before the first call to NewFrame(). NewFrame() automatically calls LoadIniSettingsFromDisk(io.IniFilename).
-    IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
+    IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source. binary data (see io.IniSavingBinary) requires a non-zero ini_size.
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
-    IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
+    IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings. only settings modified since the last save are serialized again. when io.IniSavingBinary is set, data is binary: use out_ini_size.
 
     // Debug Utilities
     IMGUI_API void          DebugTextEncoding(const char* text);
@@ -1605,6 +1614,9 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasSDF        = 1 << 4,   // Backend Renderer supports ImDrawCmdFlags_SDF. This enables rendering of fonts baked with ImFontConfig::SDF = true.
+    ImGuiBackendFlags_RendererHasCompactVtx = 1 << 5,   // Backend Renderer supports the compact ImDrawVert layout enabled by IMGUI_USE_COMPACT_DRAWVERT in imconfig.h.
+    ImGuiBackendFlags_RendererHasIdx32      = 1 << 6,   // Backend Renderer supports ImDrawList::IdxBuffer32. With 16-bit ImDrawIdx, draw lists with 64K+ vertices are converted to 32-bit indices instead of being split with ImDrawCmd::VtxOffset.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1981,6 +1993,7 @@ struct ImGuiStyle
     bool        AntiAliasedLines;           // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliased edges around filled shapes (rounded rectangles, circles, etc.). Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
+    bool        AntiAliasedFillUseTex;      // Enable anti-aliased circles, circle outlines and filled rounded rectangles using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Disabled by default as pixels differ slightly from tessellated shapes. Latched at the beginning of the frame (copied to ImDrawList).
     float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleTessellationMaxError; // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
     ImVec4      Colors[ImGuiCol_COUNT];
@@ -2026,7 +2039,9 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds. May change every frame.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    bool        IniSavingBinary;                // = false          // Save settings using a compact binary format instead of .ini text. Much faster to save/load with many windows/tables. Loading detects either format. Binary data is versioned and uses native endianness/layout.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
+    int         LogFlushThreshold;              // = 64*1024        // When logging to file/tty: accumulate output and write it once it reaches this size in bytes (and at the end of the frame, in LogFinish()). 0: write every item immediately.
     void*       UserData;                       // = NULL           // Store your own data.
 
     ImFontAtlas*Fonts;                          // <auto>           // Font atlas: load, rasterize and pack one or more fonts into a single texture.
@@ -2039,12 +2054,16 @@ struct ImGuiIO
     bool        MouseDrawCursor;                // = false          // Request ImGui to draw a mouse cursor for you (if you are on a platform without a mouse cursor). Cannot be easily renamed to 'io.ConfigXXX' because this is frequently used by backend implementations.
     bool        ConfigMacOSXBehaviors;          // = defined(__APPLE__) // OS X style: Text editing cursor movement using Alt instead of Ctrl, Shortcuts using Cmd/Super instead of Ctrl, Line/Text Start and End using Cmd+Arrows instead of Home/End, Double click selects by word instead of selecting whole text, Multi-selection in lists uses Cmd/Super instead of Ctrl.
     bool        ConfigInputTrickleEventQueue;   // = true           // Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.
+    bool        ConfigInputCoalesceEvents;      // = true           // Enable input queue coalescing: consecutive mouse position events (and consecutive mouse wheel events) are merged into a single event, which keeps the queue small with high-rate devices (e.g. pen tablets). Disable if you need every intermediate position in the event trail.
     bool        ConfigInputTextCursorBlink;     // = true           // Enable blinking cursor (optional as some users consider it to be distracting).
     bool        ConfigInputTextEnterKeepActive; // = false          // [BETA] Pressing Enter will keep item active and select contents (single-line only).
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    size_t      ConfigMemoryCompactBudget;      // = 0              // Budget (in bytes) for memory retained by transient windows/tables/tab bars buffers and temporary allocations. When exceeded, buffers of the least recently used ones are freed without waiting for ConfigMemoryCompactTimer (a few per frame). Set to 0 to disable.
+    bool        ConfigDrawListCurveCache;       // = false          // Cache auto-tessellated bezier curves (PathBezierCubicCurveTo()/PathBezierQuadraticCurveTo() with num_segments == 0) across frames, keyed by control points. Curves which don't move are flattened once and copied afterward. Worth it when drawing many static curves (e.g. node editor links), a waste when most curves move every frame.
+    bool        ConfigDrawDataMerge;            // = false          // [BETA] Post-process ImDrawData in Render(): concatenate all draw lists of a viewport into a single one, and merge consecutive draw commands sharing texture and compatible clipping rectangles (clipping axis-aligned quads on CPU). Fewer draw calls for a copy of all vertices/indices. User callbacks receive the merged draw list as 'parent_list'.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2091,6 +2110,17 @@ struct ImGuiIO
     void        (*SetClipboardTextFn)(void* user_data, const char* text);
     void*       ClipboardUserData;
 
+    // Optional: Write settings to disk yourself, e.g. on a worker thread, instead of the blocking file write done by SaveIniSettingsToDisk().
+    // 'ini_data' is an immutable snapshot which stays valid until your next call returns: wait for a pending write to complete before returning from the next call.
+    // Called with ini_data == NULL by DestroyContext() after the final save, to let you wait for the last write to complete.
+    void        (*WriteIniSettingsFn)(void* user_data, const char* ini_filename, const char* ini_data, size_t ini_size);
+    void*       WriteIniSettingsUserData;
+
+    // Optional: Receive output of LogToFile() yourself, e.g. to write it from a worker thread, instead of the file write done on the calling thread.
+    // 'data' is only valid during the call: copy it. Called with data == NULL when logging is finished, to let you close the file.
+    void        (*LogWriteFn)(void* user_data, const char* log_filename, const char* data, size_t size);
+    void*       LogWriteUserData;
+
     // Optional: Notify OS Input Method Editor of the screen position of your cursor for text input position (e.g. when using Japanese/Chinese IME on Windows)
     // (default to use native imm32 api on Windows)
     void        (*SetPlatformImeDataFn)(ImGuiViewport* viewport, ImGuiPlatformImeData* data);
@@ -2261,7 +2291,7 @@ struct ImGuiSizeCallbackData
 struct ImGuiPayload
 {
     // Members
-    void*           Data;               // Data (copied and owned by dear imgui)
+    void*           Data;               // Data (copied and owned by dear imgui, unless set with SetDragDropPayloadNoCopy(): then owned by the drag source, don't modify)
     int             DataSize;           // Data size
 
     // [Internal]
@@ -2271,9 +2301,12 @@ struct ImGuiPayload
     char            DataType[32 + 1];   // Data type tag (short user-supplied string, 32 characters max)
     bool            Preview;            // Set when AcceptDragDropPayload() was called and mouse has been hovering the target item (nb: handle overlapping drag targets)
     bool            Delivery;           // Set when AcceptDragDropPayload() was called and mouse button is released over the target item.
+    bool            DataCallbackCalled; // Set once DataCallback has been called
+    ImGuiPayloadCallback DataCallback;  // Called once when a target accepts the payload, before AcceptDragDropPayload() returns it (see SetDragDropPayloadNoCopy())
+    void*           DataCallbackUserData; // Passed to DataCallback
 
     ImGuiPayload()  { Clear(); }
-    void Clear()    { SourceId = SourceParentId = 0; Data = NULL; DataSize = 0; memset(DataType, 0, sizeof(DataType)); DataFrameCount = -1; Preview = Delivery = false; }
+    void Clear()    { SourceId = SourceParentId = 0; Data = NULL; DataSize = 0; memset(DataType, 0, sizeof(DataType)); DataFrameCount = -1; Preview = Delivery = false; DataCallbackCalled = false; DataCallback = NULL; DataCallbackUserData = NULL; }
     bool IsDataType(const char* type) const { return DataFrameCount != -1 && strcmp(type, DataType) == 0; }
     bool IsPreview() const                  { return Preview; }
     bool IsDelivery() const                 { return Delivery; }
@@ -2304,7 +2337,7 @@ struct ImGuiTableSortSpecs
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotLod, Math Operators, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2471,6 +2504,28 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Min/max level-of-detail pyramid, to plot very large arrays (millions of samples) with PlotLines()/PlotHistogram().
+// - Samples stay owned by you. The pyramid stores the min/max of blocks of 32, 64, 128... samples, about 1/8 of the samples memory.
+// - PlotLines()/PlotHistogram() taking a ImGuiPlotLod* call Build() for you, then compute each pixel column from O(log N) pyramid lookups.
+// - Build() is incremental for append-only data: only samples past the previously built count are processed, so streaming data costs O(appended samples).
+//   If you modify or remove existing samples, call Clear() to force a full rebuild. NaN values are ignored.
+// Usage:
+//   static ImVector<float> samples;
+//   static ImGuiPlotLod samples_lod;
+//   samples.push_back(new_sample);
+//   ImGui::PlotLines("Telemetry", samples.Data, samples.Size, &samples_lod);
+struct ImGuiPlotLod
+{
+    ImVector<ImVec2>    Levels[27];         // Levels[n] stores the min (x) and max (y) value of each block of (32 << n) samples
+    int                 LevelsCount;
+    int                 ValuesCount;        // Number of samples processed by Build()
+
+    IMGUI_API ImGuiPlotLod();
+    IMGUI_API void  Clear();
+    IMGUI_API void  Build(const float* values, int values_count, int stride = sizeof(float));
+    IMGUI_API bool  CalcMinMax(const float* values, int idx_begin, int idx_end, float* out_min, float* out_max, int stride = sizeof(float)) const; // Samples [idx_begin, idx_end) must have been processed by Build(). Return false if all values are NaN.
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2550,6 +2605,11 @@ struct ImColor
 #define IM_DRAWLIST_TEX_LINES_WIDTH_MAX     (63)
 #endif
 
+// The maximum circle/corner radius to bake anti-aliased textures for. Build atlas with ImFontAtlasFlags_NoBakedRoundCorners to disable baking.
+#ifndef IM_DRAWLIST_TEX_ROUND_CORNERS_MAX
+#define IM_DRAWLIST_TEX_ROUND_CORNERS_MAX   (16)
+#endif
+
 // ImDrawCallback: Draw callbacks for advanced uses [configurable type: override in imconfig.h]
 // NB: You most likely do NOT need to use draw callbacks just to create your own widget or customized UI rendering,
 // you can poke into the draw list for that! Draw callback may be useful for example to:
@@ -2571,12 +2631,15 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
-// - The ClipRect/TextureId/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
+// - Flags: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasSDF' is enabled, text using a font baked with ImFontConfig::SDF
+//   is emitted in commands with the ImDrawCmdFlags_SDF flag, which the backend needs to render with a signed distance field shader.
+// - The ClipRect/TextureId/VtxOffset/Flags fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
     ImVec4          ClipRect;           // 4*4  // Clipping rectangle (x1, y1, x2, y2). Subtract ImDrawData->DisplayPos to get clipping rectangle in "viewport" coordinates
     ImTextureID     TextureId;          // 4-8  // User-provided texture ID. Set by user in ImfontAtlas::SetTexID() for fonts or passed to Image*() functions. Ignore if never using images or multiple fonts atlas.
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
+    ImDrawCmdFlags  Flags;              // 4    // Render state requested for this command (see ImDrawCmdFlags_). Always 0 unless using SDF fonts.
     unsigned int    IdxOffset;          // 4    // Start offset in index buffer.
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
@@ -2589,13 +2652,42 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
 struct ImDrawVert
 {
     ImVec2  pos;
     ImVec2  uv;
     ImU32   col;
 };
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+// Compact vertex layout enabled by IMGUI_USE_COMPACT_DRAWVERT in imconfig.h (12 bytes instead of 20 bytes).
+// 'pos' and 'uv' can be assigned from and converted to ImVec2, the encoded values are read by renderer backends:
+// - pos: 2x ImS16, signed fixed-point with IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS fractional bits. Value = (float)Value / (1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS).
+// - uv:  2x ImU16, unsigned normalized. Value = (float)Value / 65535.0f.
+#ifndef IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS
+#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS    3
+#endif
+#define IMGUI_COMPACT_DRAWVERT_POS_RANGE        ((float)(32768 >> IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS))    // Positions are clamped to +/- this value (4096.0f with 3 fractional bits). io.DisplaySize and clip rectangles are asserted to fit.
+struct ImDrawVertPos
+{
+    ImS16   Value[2];
+    ImDrawVertPos& operator=(const ImVec2& p)   { Value[0] = Encode(p.x); Value[1] = Encode(p.y); return *this; }
+    operator ImVec2() const                     { const float scale = 1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); return ImVec2((float)Value[0] * scale, (float)Value[1] * scale); }
+    static ImS16 Encode(float f)                { f *= (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); f = (f < -32768.0f) ? -32768.0f : (f > 32767.0f) ? 32767.0f : f; return (ImS16)((int)(f + 32768.5f) - 32768); } // Round to nearest
+};
+struct ImDrawVertUV
+{
+    ImU16   Value[2];
+    ImDrawVertUV& operator=(const ImVec2& uv)   { Value[0] = Encode(uv.x); Value[1] = Encode(uv.y); return *this; }
+    operator ImVec2() const                     { return ImVec2((float)Value[0] * (1.0f / 65535.0f), (float)Value[1] * (1.0f / 65535.0f)); }
+    static ImU16 Encode(float f)                { f = (f < 0.0f) ? 0.0f : (f > 1.0f) ? 1.0f : f; return (ImU16)(f * 65535.0f + 0.5f); }
+};
+struct ImDrawVert
+{
+    ImDrawVertPos   pos;
+    ImDrawVertUV    uv;
+    ImU32           col;
+};
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
@@ -2610,6 +2702,7 @@ struct ImDrawCmdHeader
     ImVec4          ClipRect;
     ImTextureID     TextureId;
     unsigned int    VtxOffset;
+    ImDrawCmdFlags  Flags;
 };
 
 // [Internal] For use by ImDrawListSplitter
@@ -2657,6 +2750,13 @@ enum ImDrawFlags_
     ImDrawFlags_RoundCornersMask_           = ImDrawFlags_RoundCornersAll | ImDrawFlags_RoundCornersNone,
 };
 
+// Flags stored in ImDrawCmd::Flags, requesting a specific render state from the renderer backend.
+enum ImDrawCmdFlags_
+{
+    ImDrawCmdFlags_None                     = 0,
+    ImDrawCmdFlags_SDF                      = 1 << 0,  // Texture alpha holds a signed distance field (0.5 == glyph edge) rather than coverage. Set by ImFont::RenderText() for fonts baked with ImFontConfig::SDF. Require ImGuiBackendFlags_RendererHasSDF.
+};
+
 // Flags for ImDrawList instance. Those are set automatically by ImGui:: functions from ImGuiIO settings, and generally not manipulated directly.
 // It is however possible to temporarily alter flags between calls to ImDrawList:: functions.
 enum ImDrawListFlags_
@@ -2666,6 +2766,7 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AntiAliasedFillUseTex   = 1 << 4,  // Enable anti-aliased circles, circle outlines and filled rounded rectangles using textures when possible (a few quads instead of tessellated shapes). Require backend to render with bilinear filtering (NOT point/nearest filtering).
 };
 
 // Draw command list
@@ -2683,6 +2784,7 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImU32>         IdxBuffer32;        // 32-bit index buffer. When not empty, use it instead of IdxBuffer (ImDrawCmd::IdxOffset refers to it, IdxBuffer is then empty). Only filled by ImGui::Render() with 16-bit ImDrawIdx, ImGuiBackendFlags_RendererHasIdx32 and 64K+ vertices.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -2715,7 +2817,8 @@ struct ImDrawList
     // - For rectangular primitives, "p_min" and "p_max" represent the upper-left and lower-right corners.
     // - For circle primitives, use "num_segments == 0" to automatically calculate tessellation (preferred).
     //   In older versions (until Dear ImGui 1.77) the AddCircle functions defaulted to num_segments == 12.
-    //   In future versions we will use textures to provide cheaper and higher-quality circles.
+    //   With ImDrawListFlags_AntiAliasedFillUseTex (style.AntiAliasedFillUseTex), circles up to IM_DRAWLIST_TEX_ROUND_CORNERS_MAX radius with num_segments == 0,
+    //   1.0f thick circle outlines and filled rectangles with all corners rounded are rendered with a few quads sampling baked textures.
     //   Use AddNgon() and AddNgonFilled() functions if you need to guarantee a specific number of sides.
     IMGUI_API void  AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness = 1.0f);
     IMGUI_API void  AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, ImDrawFlags flags = 0, float thickness = 1.0f);   // a: upper-left, b: lower-right (== upper-left + size)
@@ -2738,6 +2841,13 @@ struct ImDrawList
     IMGUI_API void  AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0); // Cubic Bezier (4 control points)
     IMGUI_API void  AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments = 0);               // Quadratic Bezier (3 control points)
 
+    // Batched primitives
+    // - Draw 'count' shapes in a single call (e.g. scatter plot markers). Output is equivalent to calling AddRectFilled()/AddCircleFilled() in a loop,
+    //   but geometry is copied from a template built once per call, and shapes entirely outside of the current clipping rectangle are skipped.
+    // - 'cols' is optional: when not NULL it provides one color per shape and 'col' is ignored.
+    IMGUI_API void  AddRectsFilled(const ImVec2* p_min, const ImVec2* p_max, int count, ImU32 col, const ImU32* cols = NULL);
+    IMGUI_API void  AddCirclesFilled(const ImVec2* centers, int count, float radius, ImU32 col, const ImU32* cols = NULL, int num_segments = 0);
+
     // Image primitives
     // - Read FAQ to understand what ImTextureID is.
     // - "p_min" and "p_max" represent the upper-left and lower-right corners of the rectangle.
@@ -2787,6 +2897,13 @@ struct ImDrawList
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
+    // Advanced: Index width for renderer backends
+    // - IdxBuffer32 is used instead of IdxBuffer after ImGui::Render() promoted a large list to 32-bit indices (see ImGuiBackendFlags_RendererHasIdx32).
+    // - A promoted list hands its IdxBuffer storage over to IdxBuffer32, so IdxBuffer is empty: use GetIdxCount() for the number of indices.
+    inline int          GetIdxCount() const { return IdxBuffer32.Size > 0 ? IdxBuffer32.Size : IdxBuffer.Size; }
+    inline int          GetIdxSize() const  { return IdxBuffer32.Size > 0 ? 4 : (int)sizeof(ImDrawIdx); }
+    inline const void*  GetIdxData() const  { return IdxBuffer32.Size > 0 ? (const void*)IdxBuffer32.Data : (const void*)IdxBuffer.Data; }
+
     // Obsolete names
     //inline  void  AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0) { AddBezierCubic(p1, p2, p3, p4, col, thickness, num_segments); } // OBSOLETED in 1.80 (Jan 2021)
     //inline  void  PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments = 0) { PathBezierCubicCurveTo(p2, p3, p4, num_segments); } // OBSOLETED in 1.80 (Jan 2021)
@@ -2794,11 +2911,13 @@ struct ImDrawList
     // [Internal helpers]
     IMGUI_API void  _ResetForNewFrame();
     IMGUI_API void  _ClearFreeMemory();
+    IMGUI_API void  _ResetIdxBuffer32();
     IMGUI_API void  _PopUnusedDrawCmd();
     IMGUI_API void  _TryMergeDrawCmds();
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _OnChangedCmdFlags();
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
@@ -2851,6 +2970,8 @@ struct ImFontConfig
     float           RasterizerMultiply;     // 1.0f     // Linearly brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable. This is a silly thing we may remove in the future.
     float           RasterizerDensity;      // 1.0f     // DPI scale for rasterization, not altering other font metrics: make it easy to swap between e.g. a 100% and a 400% fonts for a zooming display. IMPORTANT: If you increase this it is expected that you increase font scale accordingly, otherwise quality may look lowered.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            SDF;                    // false    // Bake glyphs as a signed distance field instead of coverage, so text can be scaled (FontGlobalScale, SetWindowFontScale) without blurring. Oversampling is ignored. Require stb_truetype builder and ImGuiBackendFlags_RendererHasSDF.
+    int             SDFPadding;             // 4        // Distance (in pixels, at SizePixels) encoded around each SDF glyph outline. Larger values allow larger scaling factors and outline effects at the cost of atlas space.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -2907,6 +3028,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedRoundCorners = 1 << 3,  // Don't build circle/rounded corner textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedFillUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2950,7 +3072,15 @@ struct ImFontAtlas
     IMGUI_API void              GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 1 byte per-pixel
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
-    void                        SetTexID(ImTextureID id)    { TexID = id; }
+    void                        SetTexID(ImTextureID id)    { IM_ASSERT((!Immutable || id == TexID) && "Cannot change the TexID of an immutable ImFontAtlas!"); TexID = id; }
+
+    // Sharing an atlas between contexts and threads
+    // - Build the atlas, retrieve the pixel format(s) you need with GetTexData***() and call SetTexID(), then call SetImmutable().
+    //   From there the atlas can't be modified anymore (attempts will assert), so any number of contexts and threads may read from it without locking.
+    // - Pass it to CreateContext(): each context holds a reference to it until DestroyContext(). The atlas can't be destroyed while still referenced.
+    // - Renderer backends don't call SetTexID() on an immutable atlas: the texture is created once by the owner of the atlas and needs to outlive all the contexts using it.
+    IMGUI_API void              SetImmutable();             // Make atlas read-only, for good. It needs to be built.
+    bool                        IsImmutable() const         { return Immutable; }
 
     //-------------------------------------------
     // Glyph Ranges
@@ -2998,11 +3128,13 @@ struct ImFontAtlas
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    bool                        Immutable;          // Marked as Immutable by SetImmutable(): the atlas can't be modified anymore and may be shared between contexts used from different threads.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
     bool                        TexReady;           // Set when texture was built matching current font input
+    int                         RefCount;           // Number of contexts using this atlas (excluding a context owning it). Updated atomically by CreateContext()/DestroyContext().
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format.
     unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
     unsigned int*               TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * 4
@@ -3014,6 +3146,8 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVec4                      TexUvRoundCornersFilled[IM_DRAWLIST_TEX_ROUND_CORNERS_MAX + 1]; // UVs for baked anti-aliased filled quarter circles, indexed by radius. (x,y) = outer corner, (z,w) = center.
+    ImVec4                      TexUvRoundCornersStroke[IM_DRAWLIST_TEX_ROUND_CORNERS_MAX + 1]; // UVs for baked anti-aliased quarter circle outlines (1.0f thick), indexed by radius. (x,y) = outer corner, (z,w) = center.
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
@@ -3022,6 +3156,7 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    int                         PackIdRoundCorners; // Custom texture rectangle ID for baked anti-aliased filled circle of radius 1, followed by the outline tile, then both tiles for each radius up to IM_DRAWLIST_TEX_ROUND_CORNERS_MAX
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -3052,6 +3187,7 @@ struct ImFont
     float                       EllipsisWidth;      // 4     // out               // Width
     float                       EllipsisCharStep;   // 4     // out               // Step between characters when EllipsisCount > 0
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        IsSDF;              // 1     // out //            // Glyphs are baked as a signed distance field (ImFontConfig::SDF). Text is emitted with ImDrawCmdFlags_SDF.
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
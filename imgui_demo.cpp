@@ -460,6 +460,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::SameLine(); HelpMarker("Instruct backend to not alter mouse cursor shape and visibility.");
             ImGui::Checkbox("io.ConfigInputTrickleEventQueue", &io.ConfigInputTrickleEventQueue);
             ImGui::SameLine(); HelpMarker("Enable input queue trickling: some types of events submitted during the same frame (e.g. button down + up) will be spread over multiple frames, improving interactions with low framerates.");
+            ImGui::Checkbox("io.ConfigInputCoalesceEvents", &io.ConfigInputCoalesceEvents);
+            ImGui::SameLine(); HelpMarker("Enable input queue coalescing: consecutive mouse position events (and consecutive mouse wheel events) are merged into a single event, which keeps the queue small with high-rate devices (e.g. pen tablets).");
             ImGui::Checkbox("io.MouseDrawCursor", &io.MouseDrawCursor);
             ImGui::SameLine(); HelpMarker("Instruct Dear ImGui to render a mouse cursor itself. Note that a mouse cursor rendered via your application GPU rendering path will feel more laggy than hardware cursor, but will be more in sync with your other visuals.\n\nSome desktop applications may use both kinds of cursors (e.g. enable software cursor only when resizing/dragging something).");
 
@@ -505,6 +507,9 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &io.BackendFlags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasSDF",       &io.BackendFlags, ImGuiBackendFlags_RendererHasSDF);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasCompactVtx", &io.BackendFlags, ImGuiBackendFlags_RendererHasCompactVtx);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasIdx32",     &io.BackendFlags, ImGuiBackendFlags_RendererHasIdx32);
             ImGui::EndDisabled();
             ImGui::TreePop();
             ImGui::Spacing();
@@ -1846,6 +1851,33 @@ static void ShowDemoWindowWidgets()
         float (*func)(void*, int) = (func_type == 0) ? Funcs::Sin : Funcs::Saw;
         ImGui::PlotLines("Lines", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
+
+        // Plot very large arrays using a min/max pyramid (ImGuiPlotLod)
+        // Each pixel column displays the range of values it covers, instead of a single sample.
+        // The pyramid is updated incrementally as long as you only append to your array.
+        IMGUI_DEMO_MARKER("Widgets/Plotting/Large arrays");
+        ImGui::SeparatorText("Large arrays");
+        static ImVector<float> stream;
+        static ImGuiPlotLod stream_lod;
+        static int stream_rate = 20000;
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+        ImGui::SliderInt("Samples per frame", &stream_rate, 0, 100000);
+        ImGui::SameLine();
+        if (ImGui::Button("Clear") || stream.Size + stream_rate > 2000000)
+        {
+            stream.clear();
+            stream_lod.Clear();
+        }
+        if (animate)
+            for (int n = 0; n < stream_rate; n++)
+            {
+                const float t = (float)stream.Size * 0.0001f;
+                stream.push_back(sinf(t) + 0.5f * sinf(t * 13.0f) + ((stream.Size % 9973) == 0 ? 2.0f : 0.0f));
+            }
+        char stream_overlay[32];
+        sprintf(stream_overlay, "%d samples", stream.Size);
+        ImGui::PlotLines("Lines##stream", stream.Data, stream.Size, &stream_lod, stream_overlay, -3.0f, 3.0f, ImVec2(0, 80.0f));
+        ImGui::PlotHistogram("Histogram##stream", stream.Data, stream.Size, &stream_lod, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80.0f));
         ImGui::Separator();
 
         // Animate a simple progress bar
@@ -2443,6 +2475,50 @@ static void ShowDemoWindowWidgets()
             ImGui::TreePop();
         }
 
+        IMGUI_DEMO_MARKER("Widgets/Drag and Drop/Large payloads (no copy)");
+        if (ImGui::TreeNode("Large payloads (no copy)"))
+        {
+            HelpMarker(
+                "SetDragDropPayloadNoCopy() stores a pointer to your data instead of copying it every frame: "
+                "it needs to stay valid until the drag and drop ends.\n"
+                "The optional callback is only called when a target accepts the payload, to create data lazily.");
+            struct Funcs
+            {
+                static void ProvideAssetIds(ImGuiPayload* payload, void* user_data)
+                {
+                    ImVector<int>* asset_ids = (ImVector<int>*)user_data;
+                    if (asset_ids->empty())
+                        for (int n = 0; n < 100000; n++)
+                            asset_ids->push_back(n);
+                    payload->Data = asset_ids->Data;
+                    payload->DataSize = asset_ids->size_in_bytes();
+                }
+            };
+            static ImVector<int> asset_ids;
+            static int dropped_count = -1;
+            ImGui::Button("Drag 100000 asset IDs");
+            if (ImGui::BeginDragDropSource())
+            {
+                ImGui::SetDragDropPayloadNoCopy("DEMO_ASSET_IDS", NULL, 0, ImGuiCond_Always, Funcs::ProvideAssetIds, &asset_ids);
+                ImGui::Text("100000 asset IDs");
+                ImGui::EndDragDropSource();
+            }
+            ImGui::SameLine();
+            ImGui::Button("Drop here");
+            if (ImGui::BeginDragDropTarget())
+            {
+                if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("DEMO_ASSET_IDS"))
+                    dropped_count = payload->DataSize / (int)sizeof(int);
+                ImGui::EndDragDropTarget();
+            }
+            if (dropped_count >= 0)
+            {
+                ImGui::SameLine();
+                ImGui::Text("Dropped %d asset IDs", dropped_count);
+            }
+            ImGui::TreePop();
+        }
+
         IMGUI_DEMO_MARKER("Widgets/Drag and Drop/Tooltip at target location");
         if (ImGui::TreeNode("Tooltip at target location"))
         {
@@ -6395,6 +6471,9 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasSDF)         ImGui::Text(" RendererHasSDF");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasCompactVtx)  ImGui::Text(" RendererHasCompactVtx");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasIdx32)       ImGui::Text(" RendererHasIdx32");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -6687,6 +6766,11 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
             HelpMarker("Faster lines using texture data. Require backend to render with bilinear filtering (not point/nearest filtering).");
 
             ImGui::Checkbox("Anti-aliased fill", &style.AntiAliasedFill);
+
+            ImGui::Checkbox("Anti-aliased fill use texture", &style.AntiAliasedFillUseTex);
+            ImGui::SameLine();
+            HelpMarker("Faster circles and rounded rectangles using texture data. Require backend to render with bilinear filtering (not point/nearest filtering).");
+
             ImGui::PushItemWidth(ImGui::GetFontSize() * 8);
             ImGui::DragFloat("Curve Tessellation Tolerance", &style.CurveTessellationTol, 0.02f, 0.10f, 10.0f, "%.2f");
             if (style.CurveTessellationTol < 0.10f) style.CurveTessellationTol = 0.10f;
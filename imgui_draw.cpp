@@ -356,14 +356,30 @@ void ImGui::StyleColorsLight(ImGuiStyle* dst)
 // [SECTION] ImDrawList
 //-----------------------------------------------------------------------------
 
+// Lookup tables which don't depend on settings are shared by all ImDrawListSharedData instances (one per context).
+// They are initialized once, on first use, as a function-local static: this is thread-safe since C++11.
+static const ImVec2* ImDrawListSharedData_GetArcFastVtx()
+{
+    struct ArcFastTable
+    {
+        ImVec2 Vtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE];
+        ArcFastTable()
+        {
+            for (int i = 0; i < IM_ARRAYSIZE(Vtx); i++)
+            {
+                const float a = ((float)i * 2 * IM_PI) / (float)IM_ARRAYSIZE(Vtx);
+                Vtx[i] = ImVec2(ImCos(a), ImSin(a));
+            }
+        }
+    };
+    static const ArcFastTable table;
+    return table.Vtx;
+}
+
 ImDrawListSharedData::ImDrawListSharedData()
 {
     memset(this, 0, sizeof(*this));
-    for (int i = 0; i < IM_ARRAYSIZE(ArcFastVtx); i++)
-    {
-        const float a = ((float)i * 2 * IM_PI) / (float)IM_ARRAYSIZE(ArcFastVtx);
-        ArcFastVtx[i] = ImVec2(ImCos(a), ImSin(a));
-    }
+    ArcFastVtx = ImDrawListSharedData_GetArcFastVtx();
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
@@ -389,10 +405,12 @@ void ImDrawList::_ResetForNewFrame()
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, ClipRect) == 0);
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, TextureId) == sizeof(ImVec4));
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, VtxOffset) == sizeof(ImVec4) + sizeof(ImTextureID));
+    IM_STATIC_ASSERT(offsetof(ImDrawCmd, Flags) == sizeof(ImVec4) + sizeof(ImTextureID) + sizeof(unsigned int));
     if (_Splitter._Count > 1)
         _Splitter.Merge(this);
 
     CmdBuffer.resize(0);
+    _ResetIdxBuffer32();
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
     Flags = _Data->InitialFlags;
@@ -412,6 +430,7 @@ void ImDrawList::_ClearFreeMemory()
 {
     CmdBuffer.clear();
     IdxBuffer.clear();
+    IdxBuffer32.clear();
     VtxBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
@@ -423,11 +442,24 @@ void ImDrawList::_ClearFreeMemory()
     _Splitter.ClearFreeMemory();
 }
 
+// Take back the storage handed over to IdxBuffer32 by ImGui::PromoteDrawListToIdx32(), leaving IdxBuffer32 empty.
+void ImDrawList::_ResetIdxBuffer32()
+{
+    if (IdxBuffer32.Data == NULL)
+        return;
+    IdxBuffer.clear();
+    IdxBuffer.Data = (ImDrawIdx*)(void*)IdxBuffer32.Data;
+    IdxBuffer.Capacity = IdxBuffer32.Capacity * (int)(sizeof(ImU32) / sizeof(ImDrawIdx));
+    IdxBuffer32.Data = NULL;
+    IdxBuffer32.Size = IdxBuffer32.Capacity = 0;
+}
+
 ImDrawList* ImDrawList::CloneOutput() const
 {
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
+    dst->IdxBuffer32 = IdxBuffer32;
     dst->VtxBuffer = VtxBuffer;
     dst->Flags = Flags;
     return dst;
@@ -435,10 +467,12 @@ ImDrawList* ImDrawList::CloneOutput() const
 
 void ImDrawList::AddDrawCmd()
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImDrawList::CmdBuffer");
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TextureId = _CmdHeader.TextureId;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
+    draw_cmd.Flags = _CmdHeader.Flags;
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
@@ -474,10 +508,10 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
-// Compare ClipRect, TextureId and VtxOffset with a single memcmp()
-#define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
-#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
-#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
+// Compare ClipRect, TextureId, VtxOffset and Flags with a single memcmp()
+#define ImDrawCmd_HeaderSize                            (offsetof(ImDrawCmd, Flags) + sizeof(ImDrawCmdFlags))
+#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset, Flags
+#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset, Flags
 #define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
 
 // Try to merge two last draw commands
@@ -557,6 +591,29 @@ void ImDrawList::_OnChangedVtxOffset()
     curr_cmd->VtxOffset = _CmdHeader.VtxOffset;
 }
 
+void ImDrawList::_OnChangedCmdFlags()
+{
+    // If current command is used with different settings we need to add a new command
+    IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (curr_cmd->ElemCount != 0 && curr_cmd->Flags != _CmdHeader.Flags)
+    {
+        AddDrawCmd();
+        return;
+    }
+    IM_ASSERT(curr_cmd->UserCallback == NULL);
+
+    // Try to merge with previous command if it matches, else use current command
+    ImDrawCmd* prev_cmd = curr_cmd - 1;
+    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    {
+        CmdBuffer.pop_back();
+        return;
+    }
+
+    curr_cmd->Flags = _CmdHeader.Flags;
+}
+
 int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 {
     // Automatic segment count
@@ -581,6 +638,10 @@ void ImDrawList::PushClipRect(const ImVec2& cr_min, const ImVec2& cr_max, bool i
     }
     cr.z = ImMax(cr.x, cr.z);
     cr.w = ImMax(cr.y, cr.w);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Geometry outside of that range is clamped, which would distort visible triangles
+    IM_ASSERT(cr.x >= -IMGUI_COMPACT_DRAWVERT_POS_RANGE && cr.y >= -IMGUI_COMPACT_DRAWVERT_POS_RANGE && cr.z <= IMGUI_COMPACT_DRAWVERT_POS_RANGE && cr.w <= IMGUI_COMPACT_DRAWVERT_POS_RANGE && "Clip rectangle exceeds the position range of IMGUI_USE_COMPACT_DRAWVERT, see IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS!");
+#endif
 
     _ClipRectStack.push_back(cr);
     _CmdHeader.ClipRect = cr;
@@ -618,6 +679,7 @@ void ImDrawList::PopTextureID()
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImDrawList::PrimReserve");
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
@@ -948,10 +1010,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            _VtxWritePtr[0].pos = ImVec2(p1.x + dy, p1.y - dx); _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].pos = ImVec2(p2.x + dy, p2.y - dx); _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+            _VtxWritePtr[2].pos = ImVec2(p2.x - dy, p2.y + dx); _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+            _VtxWritePtr[3].pos = ImVec2(p1.x - dy, p1.y + dx); _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -1015,8 +1077,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            _VtxWritePtr[0].pos = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+            _VtxWritePtr[1].pos = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -1301,19 +1363,174 @@ static void PathBezierQuadraticCurveToCasteljau(ImVector<ImVec2>* path, float x1
     }
 }
 
+void ImDrawListCurveCache::Clear()
+{
+    Entries.clear();
+    Points.clear();
+    Buckets.clear();
+    Active = false;
+}
+
+static void ImDrawListCurveCache_RebuildBuckets(ImDrawListCurveCache* cache, int buckets_count)
+{
+    ImVector<int>& buckets = cache->Buckets;
+    buckets.resize(buckets_count);
+    memset(buckets.Data, 0, (size_t)buckets.size_in_bytes());
+    const int mask = buckets_count - 1;
+    for (int entry_n = 0; entry_n < cache->Entries.Size; entry_n++)
+    {
+        int bucket_n = (int)(cache->Entries.Data[entry_n].Hash & (ImU32)mask);
+        while (buckets.Data[bucket_n] != 0)
+            bucket_n = (bucket_n + 1) & mask;
+        buckets.Data[bucket_n] = entry_n + 1;
+    }
+}
+
+// Every IM_DRAWLIST_CURVE_CACHE_MAX_AGE frames (or when the points storage is full): compact away curves that haven't been used recently.
+void ImDrawListCurveCache::NewFrame()
+{
+    FrameCount++;
+    Active = true;
+    if ((FrameCount % IM_DRAWLIST_CURVE_CACHE_MAX_AGE) != 0 && Points.Size < IM_DRAWLIST_CURVE_CACHE_MAX_POINTS)
+        return;
+
+    // Entries are appended along with their points, so compacting both in place only moves data backward
+    int entries_count = 0;
+    int points_count = 0;
+    for (int entry_n = 0; entry_n < Entries.Size; entry_n++)
+    {
+        ImDrawListCurveCacheEntry entry = Entries.Data[entry_n];
+        if (FrameCount - entry.LastUsedFrame > IM_DRAWLIST_CURVE_CACHE_MAX_AGE)
+            continue;
+        if (entry.PointsOffset != points_count)
+            memmove(Points.Data + points_count, Points.Data + entry.PointsOffset, (size_t)entry.PointsCount * sizeof(ImVec2));
+        entry.PointsOffset = points_count;
+        points_count += entry.PointsCount;
+        Entries.Data[entries_count++] = entry;
+    }
+    Entries.resize(entries_count);
+    Points.resize(points_count);
+    if (Points.Size >= IM_DRAWLIST_CURVE_CACHE_MAX_POINTS)
+    {
+        Entries.resize(0);
+        Points.resize(0);
+    }
+
+    int buckets_count = 64;
+    while (buckets_count < Entries.Size * 2)
+        buckets_count *= 2;
+    ImDrawListCurveCache_RebuildBuckets(this, buckets_count);
+}
+
+// Cheaper than ImHashData(), this is called for every auto-tessellated curve
+static ImU32 ImDrawListCurveCache_HashKey(const ImVec2* ctrl, int degree, float tess_tol)
+{
+    ImU32 words[4 * 2 + 1];
+    memcpy(words, ctrl, sizeof(ImVec2) * 4);
+    memcpy(&words[4 * 2], &tess_tol, sizeof(float));
+    ImU32 h = (ImU32)degree;
+    for (int n = 0; n < IM_ARRAYSIZE(words); n++)
+    {
+        h = (h ^ words[n]) * 0x9E3779B1u;
+        h ^= h >> 15;
+    }
+    h *= 0x85EBCA77u;
+    return h ^ (h >> 13);
+}
+
+static int ImDrawListCurveCache_FindEntry(const ImDrawListCurveCache* cache, ImU32 hash, const ImVec2* ctrl, int degree, float tess_tol)
+{
+    const int* buckets = cache->Buckets.Data;
+    const int mask = cache->Buckets.Size - 1;
+    for (int bucket_n = (int)(hash & (ImU32)mask); buckets[bucket_n] != 0; bucket_n = (bucket_n + 1) & mask)
+    {
+        const ImDrawListCurveCacheEntry& entry = cache->Entries.Data[buckets[bucket_n] - 1];
+        if (entry.Hash == hash && entry.Degree == degree && memcmp(&entry.TessTol, &tess_tol, sizeof(float)) == 0 && memcmp(entry.Ctrl, ctrl, sizeof(ImVec2) * 4) == 0)
+            return buckets[bucket_n] - 1;
+    }
+    return -1;
+}
+
+// Append cached points to 'out_path' and return true on success.
+bool ImDrawListCurveCache::Lookup(const ImVec2* ctrl, int degree, float tess_tol, ImVector<ImVec2>* out_path)
+{
+    if (Entries.Size == 0)
+        return false;
+    const int entry_n = ImDrawListCurveCache_FindEntry(this, ImDrawListCurveCache_HashKey(ctrl, degree, tess_tol), ctrl, degree, tess_tol);
+    if (entry_n == -1)
+        return false;
+
+    ImDrawListCurveCacheEntry& entry = Entries.Data[entry_n];
+    entry.LastUsedFrame = FrameCount;
+    const int path_size = out_path->Size;
+    out_path->resize(path_size + entry.PointsCount);
+    memcpy(out_path->Data + path_size, Points.Data + entry.PointsOffset, (size_t)entry.PointsCount * sizeof(ImVec2));
+    return true;
+}
+
+void ImDrawListCurveCache::Store(const ImVec2* ctrl, int degree, float tess_tol, const ImVec2* points, int points_count)
+{
+    if (Points.Size + points_count > IM_DRAWLIST_CURVE_CACHE_MAX_POINTS)
+        return;
+    if ((Entries.Size + 1) * 2 > Buckets.Size) // Keep load factor under 50%
+        ImDrawListCurveCache_RebuildBuckets(this, ImMax(Buckets.Size * 2, 64));
+
+    ImDrawListCurveCacheEntry entry;
+    entry.Hash = ImDrawListCurveCache_HashKey(ctrl, degree, tess_tol);
+    entry.Degree = degree;
+    entry.TessTol = tess_tol;
+    memcpy(entry.Ctrl, ctrl, sizeof(ImVec2) * 4);
+    entry.PointsOffset = Points.Size;
+    entry.PointsCount = points_count;
+    entry.LastUsedFrame = FrameCount;
+    const int mask = Buckets.Size - 1;
+    int bucket_n = (int)(entry.Hash & (ImU32)mask);
+    while (Buckets.Data[bucket_n] != 0)
+        bucket_n = (bucket_n + 1) & mask;
+    Buckets.Data[bucket_n] = Entries.Size + 1;
+    Entries.push_back(entry);
+    Points.resize(Points.Size + points_count);
+    memcpy(Points.Data + entry.PointsOffset, points, (size_t)points_count * sizeof(ImVec2));
+}
+
+// With a fixed number of segments, points are evaluated by forward differencing: 3 (cubic) or 2 (quadratic) additions per point instead of a full polynomial evaluation.
+// Accumulated rounding errors are negligible at the segment counts used for drawing, the last point is set exactly.
 void ImDrawList::PathBezierCubicCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments)
 {
     ImVec2 p1 = _Path.back();
     if (num_segments == 0)
     {
         IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierCubicCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, _Data->CurveTessellationTol, 0); // Auto-tessellated
+        const float tess_tol = _Data->CurveTessellationTol;
+        ImDrawListCurveCache& cache = _Data->CurveCache;
+        const ImVec2 ctrl[4] = { p1, p2, p3, p4 };
+        if (cache.Active && cache.Lookup(ctrl, 3, tess_tol, &_Path))
+            return;
+        const int path_size = _Path.Size;
+        PathBezierCubicCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, tess_tol, 0); // Auto-tessellated
+        if (cache.Active)
+            cache.Store(ctrl, 3, tess_tol, _Path.Data + path_size, _Path.Size - path_size);
     }
     else
     {
-        float t_step = 1.0f / (float)num_segments;
-        for (int i_step = 1; i_step <= num_segments; i_step++)
-            _Path.push_back(ImBezierCubicCalc(p1, p2, p3, p4, t_step * i_step));
+        const float h = 1.0f / (float)num_segments;
+        const ImVec2 c = (p2 - p1) * 3.0f;
+        const ImVec2 b = (p1 - p2 * 2.0f + p3) * 3.0f;
+        const ImVec2 a = p4 - p1 + (p2 - p3) * 3.0f;
+        ImVec2 d1 = a * (h * h * h) + b * (h * h) + c * h;
+        ImVec2 d2 = a * (6.0f * h * h * h) + b * (2.0f * h * h);
+        const ImVec2 d3 = a * (6.0f * h * h * h);
+        _Path.resize(_Path.Size + num_segments);
+        ImVec2* out_ptr = _Path.Data + (_Path.Size - num_segments);
+        ImVec2 p = p1;
+        for (int i_step = 1; i_step < num_segments; i_step++)
+        {
+            p += d1;
+            d1 += d2;
+            d2 += d3;
+            *out_ptr++ = p;
+        }
+        *out_ptr = p4;
     }
 }
 
@@ -1323,13 +1540,33 @@ void ImDrawList::PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3,
     if (num_segments == 0)
     {
         IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierQuadraticCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, _Data->CurveTessellationTol, 0);// Auto-tessellated
+        const float tess_tol = _Data->CurveTessellationTol;
+        ImDrawListCurveCache& cache = _Data->CurveCache;
+        const ImVec2 ctrl[4] = { p1, p2, p3, ImVec2(0.0f, 0.0f) };
+        if (cache.Active && cache.Lookup(ctrl, 2, tess_tol, &_Path))
+            return;
+        const int path_size = _Path.Size;
+        PathBezierQuadraticCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, tess_tol, 0);// Auto-tessellated
+        if (cache.Active)
+            cache.Store(ctrl, 2, tess_tol, _Path.Data + path_size, _Path.Size - path_size);
     }
     else
     {
-        float t_step = 1.0f / (float)num_segments;
-        for (int i_step = 1; i_step <= num_segments; i_step++)
-            _Path.push_back(ImBezierQuadraticCalc(p1, p2, p3, t_step * i_step));
+        const float h = 1.0f / (float)num_segments;
+        const ImVec2 c = (p2 - p1) * 2.0f;
+        const ImVec2 b = p1 - p2 * 2.0f + p3;
+        ImVec2 d1 = b * (h * h) + c * h;
+        const ImVec2 d2 = b * (2.0f * h * h);
+        _Path.resize(_Path.Size + num_segments);
+        ImVec2* out_ptr = _Path.Data + (_Path.Size - num_segments);
+        ImVec2 p = p1;
+        for (int i_step = 1; i_step < num_segments; i_step++)
+        {
+            p += d1;
+            d1 += d2;
+            *out_ptr++ = p;
+        }
+        *out_ptr = p3;
     }
 }
 
@@ -1394,6 +1631,45 @@ void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float th
     PathStroke(col, 0, thickness);
 }
 
+// Draw a circle or a rounded rectangle from a baked quarter circle tile (see ImFontAtlasBuildRenderRoundCornersTexData()).
+// 'center_min'/'center_max' are the centers of the top-left and bottom-right corners, 'extent' is the distance covered by a tile from a corner center to its outer edge.
+// Emit a grid of 3x3 vertices for circles (4 quads), up to 4x4 vertices for rectangles (9 quads, corners mirroring the tile and edges stretching its last row/column).
+static void ImDrawList_AddRoundCornersTex(ImDrawList* draw_list, const ImVec2& center_min, const ImVec2& center_max, float extent, const ImVec4& uvs, ImU32 col)
+{
+    float xs[4], ys[4], us[4], vs[4];
+    int nx = 0, ny = 0;
+    xs[nx] = center_min.x - extent; us[nx++] = uvs.x;
+    xs[nx] = center_min.x;          us[nx++] = uvs.z;
+    if (center_max.x > center_min.x) { xs[nx] = center_max.x; us[nx++] = uvs.z; }
+    xs[nx] = center_max.x + extent; us[nx++] = uvs.x;
+    ys[ny] = center_min.y - extent; vs[ny++] = uvs.y;
+    ys[ny] = center_min.y;          vs[ny++] = uvs.w;
+    if (center_max.y > center_min.y) { ys[ny] = center_max.y; vs[ny++] = uvs.w; }
+    ys[ny] = center_max.y + extent; vs[ny++] = uvs.y;
+
+    draw_list->PrimReserve((nx - 1) * (ny - 1) * 6, nx * ny);
+    const unsigned int idx = draw_list->_VtxCurrentIdx;
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    for (int y = 0; y < ny; y++)
+        for (int x = 0; x < nx; x++, vtx_write++)
+        {
+            vtx_write->pos = ImVec2(xs[x], ys[y]);
+            vtx_write->uv = ImVec2(us[x], vs[y]);
+            vtx_write->col = col;
+        }
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    for (int y = 0; y < ny - 1; y++)
+        for (int x = 0; x < nx - 1; x++, idx_write += 6)
+        {
+            const unsigned int i = idx + y * nx + x;
+            idx_write[0] = (ImDrawIdx)i; idx_write[1] = (ImDrawIdx)(i + 1);      idx_write[2] = (ImDrawIdx)(i + nx + 1);
+            idx_write[3] = (ImDrawIdx)i; idx_write[4] = (ImDrawIdx)(i + nx + 1); idx_write[5] = (ImDrawIdx)(i + nx);
+        }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx += nx * ny;
+}
+
 // p_min = upper-left, p_max = lower-right
 // Note we don't render 1 pixels sized rectangles properly.
 void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawFlags flags, float thickness)
@@ -1415,12 +1691,24 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
     {
         PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
+        return;
     }
-    else
+
+    // Use baked textures when all corners are rounded (same rounding clamping as PathRect())
+    if ((Flags & ImDrawListFlags_AntiAliasedFillUseTex) && (Flags & ImDrawListFlags_AntiAliasedFill) && _FringeScale == 1.0f && (FixRectCornerFlags(flags) & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersAll)
     {
-        PathRect(p_min, p_max, rounding, flags);
-        PathFillConvex(col);
+        const float tex_rounding = ImMin(rounding, ImMin(ImFabs(p_max.x - p_min.x), ImFabs(p_max.y - p_min.y)) * 0.5f - 1.0f);
+        const int tex_radius = (int)ImCeil(tex_rounding);
+        if (tex_rounding >= 0.5f && tex_radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_MAX)
+        {
+            const float extent = ((float)tex_radius + 1.0f) * (tex_rounding / (float)tex_radius);
+            ImDrawList_AddRoundCornersTex(this, ImVec2(p_min.x + tex_rounding, p_min.y + tex_rounding), ImVec2(p_max.x - tex_rounding, p_max.y - tex_rounding), extent, _Data->TexUvRoundCornersFilled[tex_radius], col);
+            return;
+        }
     }
+
+    PathRect(p_min, p_max, rounding, flags);
+    PathFillConvex(col);
 }
 
 // p_min = upper-left, p_max = lower-right
@@ -1490,6 +1778,18 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
 
+    // Use baked textures for 1.0f thick outlines (centered on radius - 0.5f)
+    if (num_segments <= 0 && thickness == 1.0f && radius >= 1.0f && (Flags & ImDrawListFlags_AntiAliasedFillUseTex) && (Flags & ImDrawListFlags_AntiAliasedLines) && _FringeScale == 1.0f)
+    {
+        const int tex_radius = (int)ImCeil(radius);
+        if (tex_radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_MAX)
+        {
+            const float extent = ((float)tex_radius + 1.0f) * ((radius - 0.5f) / ((float)tex_radius - 0.5f));
+            ImDrawList_AddRoundCornersTex(this, center, center, extent, _Data->TexUvRoundCornersStroke[tex_radius], col);
+            return;
+        }
+    }
+
     if (num_segments <= 0)
     {
         // Use arc with automatic segment count
@@ -1514,6 +1814,18 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
 
+    // Use baked textures
+    if (num_segments <= 0 && (Flags & ImDrawListFlags_AntiAliasedFillUseTex) && (Flags & ImDrawListFlags_AntiAliasedFill) && _FringeScale == 1.0f)
+    {
+        const int tex_radius = (int)ImCeil(radius);
+        if (tex_radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_MAX)
+        {
+            const float extent = ((float)tex_radius + 1.0f) * (radius / (float)tex_radius);
+            ImDrawList_AddRoundCornersTex(this, center, center, extent, _Data->TexUvRoundCornersFilled[tex_radius], col);
+            return;
+        }
+    }
+
     if (num_segments <= 0)
     {
         // Use arc with automatic segment count
@@ -1586,6 +1898,237 @@ void ImDrawList::AddEllipseFilled(const ImVec2& center, float radius_x, float ra
     PathFillConvex(col);
 }
 
+// Batched primitives reserve at most IM_DRAWLIST_BATCH_VTX_CHUNK vertices at once.
+// With 16-bit indices, reservations are shrunk to fill the current command up to 64K vertices, as individual calls would.
+#define IM_DRAWLIST_BATCH_VTX_CHUNK     8192
+
+static int ImDrawList_CalcBatchChunkCount(const ImDrawList* draw_list, int remaining_count, int shape_vtx_count)
+{
+    int chunk_count = ImMin(ImMax(IM_DRAWLIST_BATCH_VTX_CHUNK / shape_vtx_count, 1), remaining_count);
+    if (sizeof(ImDrawIdx) == 2 && (draw_list->Flags & ImDrawListFlags_AllowVtxOffset))
+    {
+        const int room_count = ((1 << 16) - 1 - (int)draw_list->_VtxCurrentIdx) / shape_vtx_count;
+        if (room_count > 0)
+            chunk_count = ImMin(chunk_count, room_count);
+    }
+    return chunk_count;
+}
+
+void ImDrawList::AddRectsFilled(const ImVec2* p_min, const ImVec2* p_max, int count, ImU32 col, const ImU32* cols)
+{
+    if (count <= 0 || (cols == NULL && (col & IM_COL32_A_MASK) == 0))
+        return;
+
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    for (int chunk_start = 0, reserved = 0; chunk_start < count; chunk_start += reserved)
+    {
+        reserved = ImDrawList_CalcBatchChunkCount(this, count - chunk_start, 4);
+        const int chunk_end = chunk_start + reserved;
+        PrimReserve(reserved * 6, reserved * 4);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_end; n++)
+        {
+            const ImVec2 a = p_min[n];
+            const ImVec2 c = p_max[n];
+            const ImU32 shape_col = cols ? cols[n] : col;
+            if ((shape_col & IM_COL32_A_MASK) == 0 || a.x >= clip_rect.z || a.y >= clip_rect.w || c.x <= clip_rect.x || c.y <= clip_rect.y)
+                continue;
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            vtx_write[0].pos = a;                  vtx_write[0].uv = uv; vtx_write[0].col = shape_col;
+            vtx_write[1].pos = ImVec2(c.x, a.y);   vtx_write[1].uv = uv; vtx_write[1].col = shape_col;
+            vtx_write[2].pos = c;                  vtx_write[2].uv = uv; vtx_write[2].col = shape_col;
+            vtx_write[3].pos = ImVec2(a.x, c.y);   vtx_write[3].uv = uv; vtx_write[3].col = shape_col;
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+        const int written = (idx - _VtxCurrentIdx) / 4;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        PrimUnreserve((reserved - written) * 6, (reserved - written) * 4);
+    }
+}
+
+void ImDrawList::AddCirclesFilled(const ImVec2* centers, int count, float radius, ImU32 col, const ImU32* cols, int num_segments)
+{
+    if (count <= 0 || radius < 0.5f || (cols == NULL && (col & IM_COL32_A_MASK) == 0))
+        return;
+
+    // Use baked textures, same as AddCircleFilled(): template is a 3x3 grid of textured vertices
+    const int tex_radius = (int)ImCeil(radius);
+    if (num_segments <= 0 && (Flags & ImDrawListFlags_AntiAliasedFillUseTex) && (Flags & ImDrawListFlags_AntiAliasedFill) && _FringeScale == 1.0f && tex_radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_MAX)
+    {
+        const float tex_extent = ((float)tex_radius + 1.0f) * (radius / (float)tex_radius);
+        const ImVec4 tex_uvs = _Data->TexUvRoundCornersFilled[tex_radius];
+        const float xs[3] = { -tex_extent, 0.0f, tex_extent };
+        const float us[3] = { tex_uvs.x, tex_uvs.z, tex_uvs.x };
+        const float vs[3] = { tex_uvs.y, tex_uvs.w, tex_uvs.y };
+        ImVec2 tex_vtx_template[9], tex_uv_template[9];
+        ImDrawIdx tex_idx_template[24];
+        for (int i = 0; i < 9; i++)
+        {
+            tex_vtx_template[i] = ImVec2(xs[i % 3], xs[i / 3]);
+            tex_uv_template[i] = ImVec2(us[i % 3], vs[i / 3]);
+        }
+        for (int q = 0; q < 4; q++)
+        {
+            const int i = (q / 2) * 3 + (q % 2);
+            ImDrawIdx* idx_out = &tex_idx_template[q * 6];
+            idx_out[0] = (ImDrawIdx)i; idx_out[1] = (ImDrawIdx)(i + 1); idx_out[2] = (ImDrawIdx)(i + 4);
+            idx_out[3] = (ImDrawIdx)i; idx_out[4] = (ImDrawIdx)(i + 4); idx_out[5] = (ImDrawIdx)(i + 3);
+        }
+
+        const ImVec4 clip_rect = _CmdHeader.ClipRect;
+        for (int chunk_start = 0, reserved = 0; chunk_start < count; chunk_start += reserved)
+        {
+            reserved = ImDrawList_CalcBatchChunkCount(this, count - chunk_start, 9);
+            const int chunk_end = chunk_start + reserved;
+            PrimReserve(reserved * 24, reserved * 9);
+            ImDrawVert* vtx_write = _VtxWritePtr;
+            ImDrawIdx* idx_write = _IdxWritePtr;
+            unsigned int idx = _VtxCurrentIdx;
+            for (int n = chunk_start; n < chunk_end; n++)
+            {
+                const ImVec2 center = centers[n];
+                const ImU32 shape_col = cols ? cols[n] : col;
+                if ((shape_col & IM_COL32_A_MASK) == 0 || center.x - tex_extent >= clip_rect.z || center.y - tex_extent >= clip_rect.w || center.x + tex_extent <= clip_rect.x || center.y + tex_extent <= clip_rect.y)
+                    continue;
+                for (int i = 0; i < 9; i++)
+                {
+                    vtx_write[i].pos = ImVec2(center.x + tex_vtx_template[i].x, center.y + tex_vtx_template[i].y); vtx_write[i].uv = tex_uv_template[i]; vtx_write[i].col = shape_col;
+                }
+                for (int i = 0; i < 24; i++)
+                    idx_write[i] = (ImDrawIdx)(idx + tex_idx_template[i]);
+                vtx_write += 9;
+                idx_write += 24;
+                idx += 9;
+            }
+            const int written = (int)(idx - _VtxCurrentIdx) / 9;
+            _VtxWritePtr = vtx_write;
+            _IdxWritePtr = idx_write;
+            _VtxCurrentIdx = idx;
+            PrimUnreserve((reserved - written) * 24, (reserved - written) * 9);
+        }
+        return;
+    }
+
+    // Build the shape once around (0,0), same as AddCircleFilled()
+    IM_ASSERT(_Path.Size == 0);
+    if (num_segments <= 0)
+    {
+        _PathArcToFastEx(ImVec2(0.0f, 0.0f), radius, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
+        _Path.Size--;
+    }
+    else
+    {
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+        PathArcTo(ImVec2(0.0f, 0.0f), radius, 0.0f, a_max, num_segments - 1);
+    }
+    const int points_count = _Path.Size;
+
+    // Build templates of vertex offsets and relative indices, same as AddConvexPolyFilled() would output.
+    // TempBuffer layout: [vertex offsets][normals][indices]
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const float AA_SIZE = anti_aliased ? _FringeScale : 0.0f;
+    const int vtx_count = anti_aliased ? points_count * 2 : points_count;
+    const int idx_count = anti_aliased ? (points_count - 2) * 3 + points_count * 6 : (points_count - 2) * 3;
+    const int idx_template_size = (idx_count * (int)sizeof(ImDrawIdx) + (int)sizeof(ImVec2) - 1) / (int)sizeof(ImVec2);
+    _Data->TempBuffer.reserve_discard(vtx_count + points_count + idx_template_size);
+    ImVec2* vtx_template = _Data->TempBuffer.Data;
+    ImVec2* temp_normals = vtx_template + vtx_count;
+    ImDrawIdx* idx_template = (ImDrawIdx*)(void*)(temp_normals + points_count);
+    const ImVec2* points = _Path.Data;
+    ImDrawIdx* idx_out = idx_template;
+    const int stride = anti_aliased ? 2 : 1;
+    for (int i = 2; i < points_count; i++)
+    {
+        idx_out[0] = (ImDrawIdx)0; idx_out[1] = (ImDrawIdx)((i - 1) * stride); idx_out[2] = (ImDrawIdx)(i * stride);
+        idx_out += 3;
+    }
+    if (anti_aliased)
+    {
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dx = points[i1].x - points[i0].x;
+            float dy = points[i1].y - points[i0].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            temp_normals[i0].x = dy;
+            temp_normals[i0].y = -dx;
+        }
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dm_x = (temp_normals[i0].x + temp_normals[i1].x) * 0.5f;
+            float dm_y = (temp_normals[i0].y + temp_normals[i1].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            dm_x *= AA_SIZE * 0.5f;
+            dm_y *= AA_SIZE * 0.5f;
+            vtx_template[i1 * 2 + 0] = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y); // Inner
+            vtx_template[i1 * 2 + 1] = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y); // Outer
+            idx_out[0] = (ImDrawIdx)(i1 << 1); idx_out[1] = (ImDrawIdx)(i0 << 1); idx_out[2] = (ImDrawIdx)((i0 << 1) + 1);
+            idx_out[3] = (ImDrawIdx)((i0 << 1) + 1); idx_out[4] = (ImDrawIdx)((i1 << 1) + 1); idx_out[5] = (ImDrawIdx)(i1 << 1);
+            idx_out += 6;
+        }
+    }
+    else
+    {
+        memcpy(vtx_template, points, points_count * sizeof(ImVec2));
+    }
+    PathClear();
+
+    // Copy templates for each visible shape
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const float extent = radius + AA_SIZE;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    for (int chunk_start = 0, reserved = 0; chunk_start < count; chunk_start += reserved)
+    {
+        reserved = ImDrawList_CalcBatchChunkCount(this, count - chunk_start, vtx_count);
+        const int chunk_end = chunk_start + reserved;
+        PrimReserve(reserved * idx_count, reserved * vtx_count);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_end; n++)
+        {
+            const ImVec2 center = centers[n];
+            const ImU32 shape_col = cols ? cols[n] : col;
+            if ((shape_col & IM_COL32_A_MASK) == 0 || center.x - extent >= clip_rect.z || center.y - extent >= clip_rect.w || center.x + extent <= clip_rect.x || center.y + extent <= clip_rect.y)
+                continue;
+            if (anti_aliased)
+            {
+                const ImU32 shape_col_trans = shape_col & ~IM_COL32_A_MASK;
+                for (int i = 0; i < vtx_count; i += 2)
+                {
+                    vtx_write[i + 0].pos = ImVec2(center.x + vtx_template[i + 0].x, center.y + vtx_template[i + 0].y); vtx_write[i + 0].uv = uv; vtx_write[i + 0].col = shape_col;
+                    vtx_write[i + 1].pos = ImVec2(center.x + vtx_template[i + 1].x, center.y + vtx_template[i + 1].y); vtx_write[i + 1].uv = uv; vtx_write[i + 1].col = shape_col_trans;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < vtx_count; i++)
+                {
+                    vtx_write[i].pos = ImVec2(center.x + vtx_template[i].x, center.y + vtx_template[i].y); vtx_write[i].uv = uv; vtx_write[i].col = shape_col;
+                }
+            }
+            for (int i = 0; i < idx_count; i++)
+                idx_write[i] = (ImDrawIdx)(idx + idx_template[i]);
+            vtx_write += vtx_count;
+            idx_write += idx_count;
+            idx += vtx_count;
+        }
+        const int written = (int)(idx - _VtxCurrentIdx) / vtx_count;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        PrimUnreserve((reserved - written) * idx_count, (reserved - written) * vtx_count);
+    }
+}
+
 // Cubic Bezier takes 4 controls points
 void ImDrawList::AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments)
 {
@@ -1723,6 +2266,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImDrawListSplitter");
     IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
@@ -1753,6 +2297,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImDrawListSplitter");
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
@@ -1815,7 +2360,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd->ElemCount == 0)
-        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
+        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset, Flags
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 
@@ -1841,7 +2386,7 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
     else if (curr_cmd->ElemCount == 0)
-        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
+        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset, Flags
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 }
@@ -1915,12 +2460,14 @@ void ImDrawData::DeIndexAllBuffers()
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
-        if (cmd_list->IdxBuffer.empty())
+        const int idx_count = cmd_list->GetIdxCount();
+        if (idx_count == 0)
             continue;
-        new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
-        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
+        new_vtx_buffer.resize(idx_count);
+        for (int j = 0; j < idx_count; j++)
+            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer32.Size > 0 ? cmd_list->IdxBuffer32[j] : cmd_list->IdxBuffer[j]];
         cmd_list->VtxBuffer.swap(new_vtx_buffer);
+        cmd_list->_ResetIdxBuffer32();
         cmd_list->IdxBuffer.resize(0);
         TotalVtxCount += cmd_list->VtxBuffer.Size;
     }
@@ -1936,6 +2483,209 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
 }
 
+// Clip an axis-aligned quad as emitted by PrimRect()/PrimRectUV() (4 vertices: top-left, top-right, bottom-right, bottom-left, single color).
+// Returns false if the vertices are not such a quad. Sets 'out_empty' if the quad is entirely clipped out.
+static bool ClipAxisAlignedQuad(ImDrawVert* v, const ImVec4& clip, bool* out_empty)
+{
+    const ImVec2 p[4] = { v[0].pos, v[1].pos, v[2].pos, v[3].pos };
+    const ImVec2 uv[4] = { v[0].uv, v[1].uv, v[2].uv, v[3].uv };
+    if (p[0].y != p[1].y || p[1].x != p[2].x || p[2].y != p[3].y || p[3].x != p[0].x || p[0].x >= p[1].x || p[0].y >= p[3].y)
+        return false;
+    if (uv[0].y != uv[1].y || uv[1].x != uv[2].x || uv[2].y != uv[3].y || uv[3].x != uv[0].x)
+        return false;
+    if (v[0].col != v[1].col || v[0].col != v[2].col || v[0].col != v[3].col)
+        return false;
+    const ImVec2 p0 = p[0], p1 = p[2], uv0 = uv[0], uv1 = uv[2];
+    const ImVec2 c0(ImMax(p0.x, clip.x), ImMax(p0.y, clip.y));
+    const ImVec2 c1(ImMin(p1.x, clip.z), ImMin(p1.y, clip.w));
+    *out_empty = (c0.x >= c1.x || c0.y >= c1.y);
+    if (*out_empty)
+        return true;
+    const ImVec2 uv_scale((uv1.x - uv0.x) / (p1.x - p0.x), (uv1.y - uv0.y) / (p1.y - p0.y));
+    const ImVec2 c_uv0(uv0.x + (c0.x - p0.x) * uv_scale.x, uv0.y + (c0.y - p0.y) * uv_scale.y);
+    const ImVec2 c_uv1(uv0.x + (c1.x - p0.x) * uv_scale.x, uv0.y + (c1.y - p0.y) * uv_scale.y);
+    v[0].pos = ImVec2(c0.x, c0.y); v[0].uv = ImVec2(c_uv0.x, c_uv0.y);
+    v[1].pos = ImVec2(c1.x, c0.y); v[1].uv = ImVec2(c_uv1.x, c_uv0.y);
+    v[2].pos = ImVec2(c1.x, c1.y); v[2].uv = ImVec2(c_uv1.x, c_uv1.y);
+    v[3].pos = ImVec2(c0.x, c1.y); v[3].uv = ImVec2(c_uv0.x, c_uv1.y);
+    return true;
+}
+
+// Post-process used when io.ConfigDrawDataMerge is set: copy all draw lists of 'draw_data' into 'out_list', which then replaces them,
+// merging consecutive draw commands which share the same texture, flags and clipping rectangle.
+// - Commands whose triangles all lie within their clipping rectangle don't need it: they are given the full viewport rectangle,
+//   so consecutive ones can merge regardless of which window they come from.
+// - To get there, axis-aligned quads (e.g. text glyphs, filled rectangles) straddling the clipping rectangle are clipped on CPU,
+//   and those entirely outside of it are dropped. Other shapes crossing the clipping rectangle keep it.
+// - Backends round clipping rectangles to framebuffer pixels in different ways, so this is only done when a clipping rectangle is already
+//   aligned to framebuffer pixels (the common case). Other commands are copied as-is and only merged with commands using the same clipping rectangle.
+// - With 16-bit indices, vertices are split in ranges of 64K addressed with ImDrawCmd::VtxOffset, which requires 'allow_vtx_offset'.
+//   Without it, we return false and leave 'draw_data' untouched if there are too many vertices.
+bool ImGui::MergeDrawDataIntoSingleList(ImDrawData* draw_data, ImDrawList* out_list, bool allow_vtx_offset)
+{
+    if (draw_data->CmdListsCount == 0)
+        return false;
+    if (sizeof(ImDrawIdx) == 2 && !allow_vtx_offset && draw_data->TotalVtxCount >= (1 << 16))
+        return false;
+
+    const ImVec2 fb_scale(draw_data->FramebufferScale.x > 0.0f ? draw_data->FramebufferScale.x : 1.0f, draw_data->FramebufferScale.y > 0.0f ? draw_data->FramebufferScale.y : 1.0f);
+    const ImVec2 display_min = draw_data->DisplayPos;
+    const ImVec2 display_max = draw_data->DisplayPos + draw_data->DisplaySize;
+    const ImVec4 display_clip(display_min.x, display_min.y, display_max.x, display_max.y);
+
+    out_list->CmdBuffer.resize(0);
+    out_list->_ResetIdxBuffer32();
+    out_list->IdxBuffer.resize(0);
+    out_list->VtxBuffer.resize(draw_data->TotalVtxCount);
+    out_list->IdxBuffer.reserve(draw_data->TotalIdxCount);
+    ImDrawVert* vtx_dst = out_list->VtxBuffer.Data;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        IM_ASSERT(draw_list->IdxBuffer32.Size == 0 && "Merge before calling PromoteDrawListToIdx32()");
+        memcpy(vtx_dst, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        vtx_dst += draw_list->VtxBuffer.Size;
+    }
+
+    unsigned int list_vtx_base = 0;
+    unsigned int segment_vtx_base = 0;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (const ImDrawCmd& src_cmd : draw_list->CmdBuffer)
+        {
+            if (src_cmd.UserCallback != NULL)
+            {
+                ImDrawCmd cmd = src_cmd;
+                cmd.IdxOffset = (unsigned int)out_list->IdxBuffer.Size;
+                cmd.VtxOffset = segment_vtx_base;
+                out_list->CmdBuffer.push_back(cmd);
+                continue;
+            }
+
+            // Visible clipping rectangle. Skip commands which would be entirely clipped out.
+            const ImVec4 clip(ImMax(src_cmd.ClipRect.x, display_min.x), ImMax(src_cmd.ClipRect.y, display_min.y), ImMin(src_cmd.ClipRect.z, display_max.x), ImMin(src_cmd.ClipRect.w, display_max.y));
+            if (src_cmd.ElemCount == 0 || clip.z <= clip.x || clip.w <= clip.y)
+                continue;
+            const ImVec4 clip_fb((clip.x - display_min.x) * fb_scale.x, (clip.y - display_min.y) * fb_scale.y, (clip.z - display_min.x) * fb_scale.x, (clip.w - display_min.y) * fb_scale.y);
+            const bool clip_pixel_aligned = (ImFloor(clip_fb.x) == clip_fb.x && ImFloor(clip_fb.y) == clip_fb.y && ImFloor(clip_fb.z) == clip_fb.z && ImFloor(clip_fb.w) == clip_fb.w);
+
+            // Select range of vertices addressed by this command
+            const ImDrawIdx* idx_src = draw_list->IdxBuffer.Data + src_cmd.IdxOffset;
+            const unsigned int cmd_vtx_base = list_vtx_base + src_cmd.VtxOffset;
+            if (sizeof(ImDrawIdx) == 2)
+            {
+                unsigned int idx_max = 0;
+                for (unsigned int i = 0; i < src_cmd.ElemCount; i++)
+                    idx_max = ImMax(idx_max, (unsigned int)idx_src[i]);
+                if (cmd_vtx_base + idx_max - segment_vtx_base >= (1 << 16))
+                    segment_vtx_base = cmd_vtx_base;
+            }
+            const unsigned int idx_rebase = cmd_vtx_base - segment_vtx_base;
+
+            // Copy indices, clipping axis-aligned quads and checking whether all triangles lie within the clipping rectangle
+            ImDrawVert* vtx = out_list->VtxBuffer.Data + cmd_vtx_base;
+            const int idx_dst_start = out_list->IdxBuffer.Size;
+            bool contained = clip_pixel_aligned;
+            for (unsigned int i = 0; i + 3 <= src_cmd.ElemCount; i += 3)
+            {
+                const unsigned int i0 = idx_src[i], i1 = idx_src[i + 1], i2 = idx_src[i + 2];
+                const ImVec2 a = vtx[i0].pos, b = vtx[i1].pos, c = vtx[i2].pos;
+                int copy_count = 3;
+                if (clip_pixel_aligned && (ImMin(ImMin(a.x, b.x), c.x) < clip.x || ImMin(ImMin(a.y, b.y), c.y) < clip.y || ImMax(ImMax(a.x, b.x), c.x) > clip.z || ImMax(ImMax(a.y, b.y), c.y) > clip.w))
+                {
+                    bool empty = false;
+                    if (i + 6 <= src_cmd.ElemCount && i1 == i0 + 1 && i2 == i0 + 2 && idx_src[i + 3] == i0 && idx_src[i + 4] == i2 && idx_src[i + 5] == i0 + 3 && ClipAxisAlignedQuad(&vtx[i0], clip, &empty))
+                        copy_count = empty ? 0 : 6;
+                    else
+                        contained = false;
+                }
+                for (int n = 0; n < copy_count; n++)
+                    out_list->IdxBuffer.push_back((ImDrawIdx)(idx_src[i + n] + idx_rebase));
+                if (copy_count == 0 || copy_count == 6)
+                    i += 3;
+            }
+            const unsigned int elem_count = (unsigned int)(out_list->IdxBuffer.Size - idx_dst_start);
+            if (elem_count == 0)
+                continue;
+
+            // Merge with previous command if possible
+            const ImVec4 cmd_clip = contained ? display_clip : src_cmd.ClipRect;
+            ImDrawCmd* prev_cmd = out_list->CmdBuffer.Size > 0 ? &out_list->CmdBuffer.back() : NULL;
+            if (prev_cmd && prev_cmd->UserCallback == NULL && prev_cmd->TextureId == src_cmd.TextureId && prev_cmd->Flags == src_cmd.Flags && prev_cmd->VtxOffset == segment_vtx_base
+                && memcmp(&prev_cmd->ClipRect, &cmd_clip, sizeof(ImVec4)) == 0 && prev_cmd->IdxOffset + prev_cmd->ElemCount == (unsigned int)idx_dst_start)
+            {
+                prev_cmd->ElemCount += elem_count;
+                continue;
+            }
+            ImDrawCmd cmd = src_cmd;
+            cmd.ClipRect = cmd_clip;
+            cmd.VtxOffset = segment_vtx_base;
+            cmd.IdxOffset = (unsigned int)idx_dst_start;
+            cmd.ElemCount = elem_count;
+            out_list->CmdBuffer.push_back(cmd);
+        }
+        list_vtx_base += (unsigned int)draw_list->VtxBuffer.Size;
+    }
+
+    // Replace draw lists with our merged one
+    draw_data->CmdLists.resize(0);
+    draw_data->CmdLists.push_back(out_list);
+    draw_data->CmdListsCount = 1;
+    draw_data->TotalVtxCount = out_list->VtxBuffer.Size;
+    draw_data->TotalIdxCount = out_list->IdxBuffer.Size;
+    return true;
+}
+
+// Convert a draw list using 16-bit indices to 32-bit indices stored in IdxBuffer32.
+// - Large lists (64K+ vertices) are split in ranges of 64K vertices addressed with ImDrawCmd::VtxOffset, which fragments draw commands.
+//   Indices are rebased so every command uses VtxOffset = 0, and consecutive commands only split by VtxOffset changes are merged back.
+// - Indices are widened in place, then the storage is handed over to IdxBuffer32 and IdxBuffer is left empty (use GetIdxCount()).
+//   _ResetForNewFrame() gives the storage back to IdxBuffer, so a list promoted every frame keeps a single index buffer and doesn't reallocate.
+// - ImDrawCmd::IdxOffset values are unchanged and now refer to IdxBuffer32.
+// - Called by Render() on draw lists which were split with ImDrawCmd::VtxOffset (64K+ vertices reserved at some point, even if
+//   PrimUnreserve() later shrank the list) when the renderer backend sets ImGuiBackendFlags_RendererHasIdx32.
+void ImGui::PromoteDrawListToIdx32(ImDrawList* draw_list)
+{
+    IM_ASSERT(sizeof(ImDrawIdx) == 2);
+    IM_ASSERT(draw_list->IdxBuffer32.Data == NULL);
+    const int idx_count = draw_list->IdxBuffer.Size;
+    draw_list->IdxBuffer.reserve(idx_count * (int)(sizeof(ImU32) / sizeof(ImDrawIdx)));
+
+    // Widen from the last index down: the 32-bit write of index i only overlaps 16-bit indices >= i, which were already read.
+    // Accesses go through memcpy() as the same bytes are read as ImDrawIdx and written as ImU32.
+    char* idx_data = (char*)draw_list->IdxBuffer.Data;
+    for (int cmd_n = draw_list->CmdBuffer.Size - 1; cmd_n >= 0; cmd_n--)
+    {
+        const ImDrawCmd& src_cmd = draw_list->CmdBuffer.Data[cmd_n];
+        IM_ASSERT(cmd_n == 0 || src_cmd.IdxOffset >= draw_list->CmdBuffer.Data[cmd_n - 1].IdxOffset + draw_list->CmdBuffer.Data[cmd_n - 1].ElemCount);
+        for (unsigned int i = src_cmd.IdxOffset + src_cmd.ElemCount; i-- > src_cmd.IdxOffset; )
+        {
+            ImDrawIdx idx16;
+            memcpy(&idx16, idx_data + i * sizeof(ImDrawIdx), sizeof(idx16));
+            const ImU32 idx32 = (ImU32)idx16 + src_cmd.VtxOffset;
+            memcpy(idx_data + i * sizeof(ImU32), &idx32, sizeof(idx32));
+        }
+    }
+    draw_list->IdxBuffer32.Data = (ImU32*)(void*)draw_list->IdxBuffer.Data;
+    draw_list->IdxBuffer32.Size = idx_count;
+    draw_list->IdxBuffer32.Capacity = draw_list->IdxBuffer.Capacity / (int)(sizeof(ImU32) / sizeof(ImDrawIdx));
+    draw_list->IdxBuffer.Data = NULL;
+    draw_list->IdxBuffer.Size = draw_list->IdxBuffer.Capacity = 0;
+
+    // Merge commands which were only split by VtxOffset changes
+    ImDrawCmd* cmd_dst = draw_list->CmdBuffer.Data;
+    for (const ImDrawCmd& src_cmd : draw_list->CmdBuffer)
+    {
+        ImDrawCmd cmd = src_cmd;
+        cmd.VtxOffset = 0;
+        ImDrawCmd* prev_cmd = (cmd_dst > draw_list->CmdBuffer.Data) ? cmd_dst - 1 : NULL;
+        if (prev_cmd && ImDrawCmd_HeaderCompare(prev_cmd, &cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, (&cmd)) && prev_cmd->UserCallback == NULL && cmd.UserCallback == NULL)
+            prev_cmd->ElemCount += cmd.ElemCount;
+        else
+            *cmd_dst++ = cmd;
+    }
+    draw_list->CmdBuffer.resize((int)(cmd_dst - draw_list->CmdBuffer.Data));
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -1955,7 +2705,7 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
     for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
     {
-        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float d = ImDot((ImVec2)vert->pos - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
         int r = (int)(col0_r + col_delta_r * t);
         int g = (int)(col0_g + col_delta_g * t);
@@ -1980,12 +2730,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            vertex->uv = ImClamp(uv_a + ImMul((ImVec2)vertex->pos - a, scale), min, max);
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            vertex->uv = uv_a + ImMul((ImVec2)vertex->pos - a, scale);
     }
 }
 
@@ -1994,7 +2744,7 @@ void ImGui::ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, in
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
     for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-        vertex->pos = ImRotate(vertex->pos- pivot_in, cos_a, sin_a) + pivot_out;
+        vertex->pos = ImRotate((ImVec2)vertex->pos - pivot_in, cos_a, sin_a) + pivot_out;
 }
 
 //-----------------------------------------------------------------------------
@@ -2011,6 +2761,7 @@ ImFontConfig::ImFontConfig()
     RasterizerMultiply = 1.0f;
     RasterizerDensity = 1.0f;
     EllipsisChar = (ImWchar)-1;
+    SDFPadding = 4;
 }
 
 //-----------------------------------------------------------------------------
@@ -2071,18 +2822,21 @@ ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
 }
 
 ImFontAtlas::~ImFontAtlas()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(RefCount == 0 && "Cannot destroy an ImFontAtlas still used by a context! Call DestroyContext() first.");
+    Immutable = false;
     Clear();
 }
 
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
     for (ImFontConfig& font_cfg : ConfigData)
         if (font_cfg.FontData && font_cfg.FontDataOwnedByAtlas)
         {
@@ -2099,13 +2853,14 @@ void    ImFontAtlas::ClearInputData()
         }
     ConfigData.clear();
     CustomRects.clear();
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
     // Important: we leave TexReady untouched
 }
 
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
     if (TexPixelsAlpha8)
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -2119,6 +2874,7 @@ void    ImFontAtlas::ClearTexData()
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
     Fonts.clear_delete();
     TexReady = false;
 }
@@ -2130,6 +2886,13 @@ void    ImFontAtlas::Clear()
     ClearFonts();
 }
 
+void    ImFontAtlas::SetImmutable()
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(IsBuilt() && "Build the atlas (e.g. call GetTexDataAsRGBA32()) before calling SetImmutable()!");
+    Immutable = true;
+}
+
 void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
     // Build atlas on demand
@@ -2148,6 +2911,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
     {
+        IM_ASSERT(!Immutable && "Call GetTexDataAsRGBA32() before SetImmutable() if you need RGBA32 pixels!");
         unsigned char* pixels = NULL;
         GetTexDataAsAlpha8(&pixels, NULL, NULL);
         if (pixels)
@@ -2169,8 +2933,10 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
+    IM_ASSERT(!font_cfg->SDF || font_cfg->SDFPadding > 0);
 
     // Create new font
     if (!font_cfg->MergeMode)
@@ -2241,6 +3007,7 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
     size_t data_size = 0;
     void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
     if (!data)
@@ -2263,6 +3030,7 @@ ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels,
 ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* font_data, int font_data_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
     ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
     IM_ASSERT(font_cfg.FontData == NULL);
     IM_ASSERT(font_data_size > 100 && "Incorrect value for font_data_size!"); // Heuristic to prevent accidentally passing a wrong value to font_data_size.
@@ -2298,6 +3066,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed
 
 int ImFontAtlas::AddCustomRectRegular(int width, int height)
 {
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
     IM_ASSERT(width > 0 && width <= 0xFFFF);
     IM_ASSERT(height > 0 && height <= 0xFFFF);
     ImFontAtlasCustomRect r;
@@ -2312,6 +3081,7 @@ int ImFontAtlas::AddCustomRectFontGlyph(ImFont* font, ImWchar id, int width, int
 #ifdef IMGUI_USE_WCHAR32
     IM_ASSERT(id <= IM_UNICODE_CODEPOINT_MAX);
 #endif
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
     IM_ASSERT(font != NULL);
     IM_ASSERT(width > 0 && width <= 0xFFFF);
     IM_ASSERT(height > 0 && height <= 0xFFFF);
@@ -2357,7 +3127,9 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 
 bool    ImFontAtlas::Build()
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImFontAtlas::Build");
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(!Immutable && "Cannot modify an immutable ImFontAtlas!");
 
     // Default font is none are specified
     if (ConfigData.Size == 0)
@@ -2440,6 +3212,47 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// Render signed distance field glyphs into their packed rectangles. This is the SDF equivalent of stbtt_PackFontRangesRenderIntoRects().
+// Distances are encoded so that 128 is the glyph outline, and 'cfg.SDFPadding' pixels away from it saturate to 0 (outside) or 255 (inside).
+static void ImFontAtlasBuildRenderGlyphsSDF(ImFontAtlas* atlas, ImFontBuildSrcData& src_tmp, const ImFontConfig& cfg)
+{
+    const float scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
+    const float pixel_dist_scale = 127.0f / (float)cfg.SDFPadding;
+    const int padding = atlas->TexGlyphPadding;
+    for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+    {
+        const stbrp_rect& r = src_tmp.Rects[glyph_i];
+        if (!r.was_packed)
+            continue;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+
+        // Blank glyphs (e.g. space) don't have a bitmap, but still need their advance
+        const int dst_x = r.x + padding;
+        const int dst_y = r.y + padding;
+        int w = 0, h = 0, off_x = 0, off_y = 0;
+        if (unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&src_tmp.FontInfo, scale, glyph_index_in_font, cfg.SDFPadding, 128, pixel_dist_scale, &w, &h, &off_x, &off_y))
+        {
+            IM_ASSERT(w <= r.w - padding && h <= r.h - padding);
+            for (int y = 0; y < h; y++)
+                memcpy(atlas->TexPixelsAlpha8 + (dst_y + y) * atlas->TexWidth + dst_x, sdf_pixels + y * w, (size_t)w);
+            stbtt_FreeSDF(sdf_pixels, src_tmp.FontInfo.userdata);
+        }
+
+        stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+        pc.x0 = (unsigned short)dst_x;
+        pc.y0 = (unsigned short)dst_y;
+        pc.x1 = (unsigned short)(dst_x + w);
+        pc.y1 = (unsigned short)(dst_y + h);
+        pc.xoff = (float)off_x;
+        pc.yoff = (float)off_y;
+        pc.xoff2 = (float)(off_x + w);
+        pc.yoff2 = (float)(off_y + h);
+        pc.xadvance = scale * advance;
+    }
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2583,9 +3396,20 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            if (cfg.SDF)
+            {
+                // Signed distance field glyphs are not oversampled, and their distance padding is added on each side (this matches stbtt_GetGlyphSDF)
+                stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
+                const int sdf_padding = (x0 == x1 || y0 == y1) ? 0 : cfg.SDFPadding;
+                src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + sdf_padding * 2 + padding);
+                src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + sdf_padding * 2 + padding);
+            }
+            else
+            {
+                stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+                src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+                src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            }
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -2639,6 +3463,14 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
+        if (cfg.SDF)
+        {
+            // Multiply operator is not applied as it would distort distances
+            ImFontAtlasBuildRenderGlyphsSDF(atlas, src_tmp, cfg);
+            src_tmp.Rects = NULL;
+            continue;
+        }
+
         stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
 
         // Apply multiply operator
@@ -2705,8 +3537,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
 const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithStbTruetype };
     return &io;
 }
 
@@ -2736,6 +3567,12 @@ void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* f
         font->ContainerAtlas = atlas;
         font->Ascent = ascent;
         font->Descent = descent;
+        font->IsSDF = font_config->SDF;
+    }
+    else
+    {
+        // Merged sources are rendered with the same ImDrawCmd flags as the destination font
+        IM_ASSERT(font->IsSDF == font_config->SDF && "Cannot merge SDF and non-SDF sources into a same font!");
     }
 }
 
@@ -2880,6 +3717,57 @@ static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
     }
 }
 
+// Bake anti-aliased quarter circles used to draw circles and rounded rectangles with a few textured quads.
+// For each radius R we bake a filled tile and an outline tile (1.0f thick, centered on R - 0.5f like AddCircle()), each preceded by a transparent border texel.
+// A tile covers (R + 2) pixels: the circle center is on the boundary between the last two pixels, so that pixel centers land on the ends of the 1 pixel
+// linear fringe (matching tessellated shapes). In filled tiles, the last two rows/columns are computed as if on the axis, so that the straight edges of
+// a rounded rectangle, which sample between them, get the exact fringe. Outline tiles are oversampled, as bilinear filtering would blur a 1 pixel wide
+// profile sampled once per pixel.
+static void ImFontAtlasBuildRenderRoundCornersTexData(ImFontAtlas* atlas)
+{
+    if (atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners)
+        return;
+
+    const int w = atlas->TexWidth;
+    for (int radius = 1; radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_MAX; radius++)
+        for (int stroke = 0; stroke < 2; stroke++)
+        {
+            ImFontAtlasCustomRect* r = atlas->GetCustomRectByIndex(atlas->PackIdRoundCorners + (radius - 1) * 2 + stroke);
+            IM_ASSERT(r->IsPacked());
+            const int oversample = stroke ? IM_DRAWLIST_TEX_ROUND_CORNERS_STROKE_OVERSAMPLE : 1;
+            const int tile_size = (radius + 2) * oversample;
+            IM_ASSERT(r->Width == tile_size + 1 && r->Height == tile_size + 1);
+            const int tile_x = r->X + 1;
+            const int tile_y = r->Y + 1;
+            const float center = (float)(radius + 1);
+            for (int y = -1; y < tile_size; y++)
+                for (int x = -1; x < tile_size; x++)
+                {
+                    float coverage = 0.0f;
+                    if (x >= 0 && y >= 0)
+                    {
+                        const float dx = (!stroke && x >= radius) ? 0.0f : center - ((float)x + 0.5f) / oversample;
+                        const float dy = (!stroke && y >= radius) ? 0.0f : center - ((float)y + 0.5f) / oversample;
+                        const float dist = ImSqrt(dx * dx + dy * dy);
+                        coverage = stroke ? 1.0f - ImFabs(dist - ((float)radius - 0.5f)) : (float)radius + 0.5f - dist;
+                    }
+                    const unsigned int alpha = (unsigned int)IM_F32_TO_INT8_SAT(coverage);
+                    const int offset = (tile_x + x) + (tile_y + y) * w;
+                    if (atlas->TexPixelsAlpha8 != NULL)
+                        atlas->TexPixelsAlpha8[offset] = (unsigned char)alpha;
+                    else
+                        atlas->TexPixelsRGBA32[offset] = IM_COL32(255, 255, 255, alpha);
+                }
+
+            // UVs: outer edge of the first texel, circle center
+            const ImVec4 uvs = ImVec4((float)tile_x * atlas->TexUvScale.x, (float)tile_y * atlas->TexUvScale.y, ((float)tile_x + center * oversample) * atlas->TexUvScale.x, ((float)tile_y + center * oversample) * atlas->TexUvScale.y);
+            if (stroke)
+                atlas->TexUvRoundCornersStroke[radius] = uvs;
+            else
+                atlas->TexUvRoundCornersFilled[radius] = uvs;
+        }
+}
+
 // Note: this is called / shared by both the stb_truetype and the FreeType builder
 void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 {
@@ -2906,6 +3794,19 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
         if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
+
+    // Register texture regions for circles and rounded corners: a filled and an outline tile for each radius, the +1 is for the transparent border
+    if (atlas->PackIdRoundCorners < 0)
+    {
+        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+            for (int radius = 1; radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_MAX; radius++)
+            {
+                const int id = atlas->AddCustomRectRegular(radius + 2 + 1, radius + 2 + 1);
+                atlas->AddCustomRectRegular((radius + 2) * IM_DRAWLIST_TEX_ROUND_CORNERS_STROKE_OVERSAMPLE + 1, (radius + 2) * IM_DRAWLIST_TEX_ROUND_CORNERS_STROKE_OVERSAMPLE + 1);
+                if (radius == 1)
+                    atlas->PackIdRoundCorners = id;
+            }
+    }
 }
 
 // This is called/shared by both the stb_truetype and the FreeType builder.
@@ -2915,6 +3816,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     IM_ASSERT(atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL);
     ImFontAtlasBuildRenderDefaultTexData(atlas);
     ImFontAtlasBuildRenderLinesTexData(atlas);
+    ImFontAtlasBuildRenderRoundCornersTexData(atlas);
 
     // Register custom rectangle glyphs
     for (int i = 0; i < atlas->CustomRects.Size; i++)
@@ -2999,6 +3901,14 @@ static void UnpackAccumulativeOffsetsIntoRanges(int base_codepoint, const short*
     out_ranges[0] = 0;
 }
 
+// Called from the initializer of a function-local static, so ranges are unpacked once in a thread-safe manner (C++11 guarantees it).
+static bool UnpackBaseRangesAndAccumulativeOffsets(const ImWchar* base_ranges, int base_ranges_count, int base_codepoint, const short* accumulative_offsets, int accumulative_offsets_count, ImWchar* out_ranges)
+{
+    memcpy(out_ranges, base_ranges, (size_t)base_ranges_count * sizeof(ImWchar));
+    UnpackAccumulativeOffsetsIntoRanges(base_codepoint, accumulative_offsets, accumulative_offsets_count, out_ranges + base_ranges_count);
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas glyph ranges helpers
 //-------------------------------------------------------------------------
@@ -3053,7 +3963,7 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesChineseSimplifiedCommon()
         2,2,7,34,21,13,70,2,128,1,1,2,1,1,2,1,1,3,2,2,2,15,1,4,1,3,4,42,10,6,1,49,85,8,1,2,1,1,4,4,2,3,6,1,5,7,4,3,211,4,1,2,1,2,5,1,2,4,2,2,6,5,6,
         10,3,4,48,100,6,2,16,296,5,27,387,2,2,3,7,16,8,5,38,15,39,21,9,10,3,7,59,13,27,21,47,5,21,6
     };
-    static ImWchar base_ranges[] = // not zero-terminated
+    static const ImWchar base_ranges[] = // not zero-terminated
     {
         0x0020, 0x00FF, // Basic Latin + Latin Supplement
         0x2000, 0x206F, // General Punctuation
@@ -3063,11 +3973,8 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesChineseSimplifiedCommon()
         0xFFFD, 0xFFFD  // Invalid
     };
     static ImWchar full_ranges[IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00) * 2 + 1] = { 0 };
-    if (!full_ranges[0])
-    {
-        memcpy(full_ranges, base_ranges, sizeof(base_ranges));
-        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges + IM_ARRAYSIZE(base_ranges));
-    }
+    static const bool full_ranges_unpacked = UnpackBaseRangesAndAccumulativeOffsets(base_ranges, IM_ARRAYSIZE(base_ranges), 0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges);
+    IM_UNUSED(full_ranges_unpacked);
     return &full_ranges[0];
 }
 
@@ -3144,7 +4051,7 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesJapanese()
         4,1,10,3,1,6,1,2,51,5,40,15,24,43,22928,11,1,13,154,70,3,1,1,7,4,10,1,2,1,1,2,1,2,1,2,2,1,1,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,
         3,2,1,1,1,1,2,1,1,
     };
-    static ImWchar base_ranges[] = // not zero-terminated
+    static const ImWchar base_ranges[] = // not zero-terminated
     {
         0x0020, 0x00FF, // Basic Latin + Latin Supplement
         0x3000, 0x30FF, // CJK Symbols and Punctuations, Hiragana, Katakana
@@ -3153,11 +4060,8 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesJapanese()
         0xFFFD, 0xFFFD  // Invalid
     };
     static ImWchar full_ranges[IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00)*2 + 1] = { 0 };
-    if (!full_ranges[0])
-    {
-        memcpy(full_ranges, base_ranges, sizeof(base_ranges));
-        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges + IM_ARRAYSIZE(base_ranges));
-    }
+    static const bool full_ranges_unpacked = UnpackBaseRangesAndAccumulativeOffsets(base_ranges, IM_ARRAYSIZE(base_ranges), 0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges);
+    IM_UNUSED(full_ranges_unpacked);
     return &full_ranges[0];
 }
 
@@ -3258,6 +4162,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    IsSDF = false;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -3279,6 +4184,7 @@ void    ImFont::ClearOutputData()
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
+    IsSDF = false;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
 }
@@ -3293,6 +4199,7 @@ static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_cha
 
 void ImFont::BuildLookupTable()
 {
+    IMGUI_DEBUG_ALLOC_SITE("ImFont::BuildLookupTable");
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -3685,8 +4592,19 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     float x = IM_TRUNC(pos.x);
     float y = IM_TRUNC(pos.y);
+    const ImDrawCmdFlags backup_cmd_flags = draw_list->_CmdHeader.Flags;
+    if (IsSDF && !(backup_cmd_flags & ImDrawCmdFlags_SDF))
+    {
+        draw_list->_CmdHeader.Flags |= ImDrawCmdFlags_SDF;
+        draw_list->_OnChangedCmdFlags();
+    }
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+    if (draw_list->_CmdHeader.Flags != backup_cmd_flags)
+    {
+        draw_list->_CmdHeader.Flags = backup_cmd_flags;
+        draw_list->_OnChangedCmdFlags();
+    }
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -3744,6 +4662,14 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     if (s == text_end)
         return;
 
+    // Signed distance field glyphs are emitted in commands flagged with ImDrawCmdFlags_SDF, so the backend can select a matching shader.
+    const ImDrawCmdFlags backup_cmd_flags = draw_list->_CmdHeader.Flags;
+    if (IsSDF && !(backup_cmd_flags & ImDrawCmdFlags_SDF))
+    {
+        draw_list->_CmdHeader.Flags |= ImDrawCmdFlags_SDF;
+        draw_list->_OnChangedCmdFlags();
+    }
+
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
@@ -3850,10 +4776,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
                 {
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    vtx_write[0].pos = ImVec2(x1, y1); vtx_write[0].col = glyph_col; vtx_write[0].uv = ImVec2(u1, v1);
+                    vtx_write[1].pos = ImVec2(x2, y1); vtx_write[1].col = glyph_col; vtx_write[1].uv = ImVec2(u2, v1);
+                    vtx_write[2].pos = ImVec2(x2, y2); vtx_write[2].col = glyph_col; vtx_write[2].uv = ImVec2(u2, v2);
+                    vtx_write[3].pos = ImVec2(x1, y2); vtx_write[3].col = glyph_col; vtx_write[3].uv = ImVec2(u1, v2);
                     idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
                     idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
                     vtx_write += 4;
@@ -3872,6 +4798,13 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+
+    // Restore command flags for subsequent primitives
+    if (draw_list->_CmdHeader.Flags != backup_cmd_flags)
+    {
+        draw_list->_CmdHeader.Flags = backup_cmd_flags;
+        draw_list->_OnChangedCmdFlags();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -4095,44 +5028,49 @@ static unsigned int stb_decompress_length(const unsigned char *input)
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
-static void stb__match(const unsigned char *data, unsigned int length)
+// [DEAR IMGUI] Decompression state is passed around instead of using globals, so fonts can be decompressed from multiple threads.
+struct stb__decompress_state
+{
+    unsigned char *barrier_out_e, *barrier_out_b;
+    const unsigned char *barrier_in_b;
+    unsigned char *dout;
+};
+
+static void stb__match(stb__decompress_state *s, const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
-    IM_ASSERT(stb__dout + length <= stb__barrier_out_e);
-    if (stb__dout + length > stb__barrier_out_e) { stb__dout += length; return; }
-    if (data < stb__barrier_out_b) { stb__dout = stb__barrier_out_e+1; return; }
-    while (length--) *stb__dout++ = *data++;
+    IM_ASSERT(s->dout + length <= s->barrier_out_e);
+    if (s->dout + length > s->barrier_out_e) { s->dout += length; return; }
+    if (data < s->barrier_out_b) { s->dout = s->barrier_out_e+1; return; }
+    while (length--) *s->dout++ = *data++;
 }
 
-static void stb__lit(const unsigned char *data, unsigned int length)
+static void stb__lit(stb__decompress_state *s, const unsigned char *data, unsigned int length)
 {
-    IM_ASSERT(stb__dout + length <= stb__barrier_out_e);
-    if (stb__dout + length > stb__barrier_out_e) { stb__dout += length; return; }
-    if (data < stb__barrier_in_b) { stb__dout = stb__barrier_out_e+1; return; }
-    memcpy(stb__dout, data, length);
-    stb__dout += length;
+    IM_ASSERT(s->dout + length <= s->barrier_out_e);
+    if (s->dout + length > s->barrier_out_e) { s->dout += length; return; }
+    if (data < s->barrier_in_b) { s->dout = s->barrier_out_e+1; return; }
+    memcpy(s->dout, data, length);
+    s->dout += length;
 }
 
 #define stb__in2(x)   ((i[x] << 8) + i[(x)+1])
 #define stb__in3(x)   ((i[x] << 16) + stb__in2((x)+1))
 #define stb__in4(x)   ((i[x] << 24) + stb__in3((x)+1))
 
-static const unsigned char *stb_decompress_token(const unsigned char *i)
+static const unsigned char *stb_decompress_token(stb__decompress_state *s, const unsigned char *i)
 {
     if (*i >= 0x20) { // use fewer if's for cases that expand small
-        if (*i >= 0x80)       stb__match(stb__dout-i[1]-1, i[0] - 0x80 + 1), i += 2;
-        else if (*i >= 0x40)  stb__match(stb__dout-(stb__in2(0) - 0x4000 + 1), i[2]+1), i += 3;
-        else /* *i >= 0x20 */ stb__lit(i+1, i[0] - 0x20 + 1), i += 1 + (i[0] - 0x20 + 1);
+        if (*i >= 0x80)       stb__match(s, s->dout-i[1]-1, i[0] - 0x80 + 1), i += 2;
+        else if (*i >= 0x40)  stb__match(s, s->dout-(stb__in2(0) - 0x4000 + 1), i[2]+1), i += 3;
+        else /* *i >= 0x20 */ stb__lit(s, i+1, i[0] - 0x20 + 1), i += 1 + (i[0] - 0x20 + 1);
     } else { // more ifs for cases that expand large, since overhead is amortized
-        if (*i >= 0x18)       stb__match(stb__dout-(stb__in3(0) - 0x180000 + 1), i[3]+1), i += 4;
-        else if (*i >= 0x10)  stb__match(stb__dout-(stb__in3(0) - 0x100000 + 1), stb__in2(3)+1), i += 5;
-        else if (*i >= 0x08)  stb__lit(i+2, stb__in2(0) - 0x0800 + 1), i += 2 + (stb__in2(0) - 0x0800 + 1);
-        else if (*i == 0x07)  stb__lit(i+3, stb__in2(1) + 1), i += 3 + (stb__in2(1) + 1);
-        else if (*i == 0x06)  stb__match(stb__dout-(stb__in3(1)+1), i[4]+1), i += 5;
-        else if (*i == 0x04)  stb__match(stb__dout-(stb__in3(1)+1), stb__in2(4)+1), i += 6;
+        if (*i >= 0x18)       stb__match(s, s->dout-(stb__in3(0) - 0x180000 + 1), i[3]+1), i += 4;
+        else if (*i >= 0x10)  stb__match(s, s->dout-(stb__in3(0) - 0x100000 + 1), stb__in2(3)+1), i += 5;
+        else if (*i >= 0x08)  stb__lit(s, i+2, stb__in2(0) - 0x0800 + 1), i += 2 + (stb__in2(0) - 0x0800 + 1);
+        else if (*i == 0x07)  stb__lit(s, i+3, stb__in2(1) + 1), i += 3 + (stb__in2(1) + 1);
+        else if (*i == 0x06)  stb__match(s, s->dout-(stb__in3(1)+1), i[4]+1), i += 5;
+        else if (*i == 0x04)  stb__match(s, s->dout-(stb__in3(1)+1), stb__in2(4)+1), i += 6;
     }
     return i;
 }
@@ -4173,19 +5111,20 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
     if (stb__in4(0) != 0x57bC0000) return 0;
     if (stb__in4(4) != 0)          return 0; // error! stream is > 4GB
     const unsigned int olen = stb_decompress_length(i);
-    stb__barrier_in_b = i;
-    stb__barrier_out_e = output + olen;
-    stb__barrier_out_b = output;
+    stb__decompress_state s;
+    s.barrier_in_b = i;
+    s.barrier_out_e = output + olen;
+    s.barrier_out_b = output;
     i += 16;
 
-    stb__dout = output;
+    s.dout = output;
     for (;;) {
         const unsigned char *old_i = i;
-        i = stb_decompress_token(i);
+        i = stb_decompress_token(&s, i);
         if (i == old_i) {
             if (*i == 0x05 && i[1] == 0xfa) {
-                IM_ASSERT(stb__dout == output + olen);
-                if (stb__dout != output + olen) return 0;
+                IM_ASSERT(s.dout == output + olen);
+                if (s.dout != output + olen) return 0;
                 if (stb_adler32(1, output, olen) != (unsigned int) stb__in4(2))
                     return 0;
                 return olen;
@@ -4194,8 +5133,8 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
                 return 0;
             }
         }
-        IM_ASSERT(stb__dout <= output + olen);
-        if (stb__dout > output + olen)
+        IM_ASSERT(s.dout <= output + olen);
+        if (s.dout > output + olen)
             return 0;
     }
 }
@@ -25,6 +25,7 @@ Index of this file:
 // [SECTION] Viewport support
 // [SECTION] Settings support
 // [SECTION] Localization support
+// [SECTION] Garbage collection support
 // [SECTION] Metrics, Debug tools
 // [SECTION] Generic context hooks
 // [SECTION] ImGuiContext (main imgui context)
@@ -124,13 +125,16 @@ struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataVarInfo;            // Variable information (e.g. to avoid style variables from an enum)
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
+struct ImGuiGcObject;               // A window/table/tab bar whose transient buffers may be compacted by the garbage collector
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
 struct ImGuiLastItemData;           // Status storage for last submitted items
 struct ImGuiLocEntry;               // A localization entry.
+struct ImGuiMemoryUsage;            // Used/retained bytes of transient buffers, as measured by the garbage collector
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiNavItemData;            // Result of a gamepad/keyboard directional navigation move query result
+struct ImGuiNavItemIndex;           // Navigable items retained from last frame, used to resolve move requests in windows with many items
 struct ImGuiNavTreeNodeData;        // Temporary storage for last TreeNode() being a Left arrow landing candidate.
 struct ImGuiMetricsConfig;          // Storage for ShowMetricsWindow() and DebugNodeXXX() functions
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
@@ -186,8 +190,12 @@ typedef void (*ImGuiErrorLogCallback)(void* user_data, const char* fmt, ...);
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+extern IMGUI_API thread_local ImGuiContext* GImGui;  // Current implicit context pointer, per thread
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
 
 //-------------------------------------------------------------------------
 // [SECTION] STB libraries includes
@@ -235,6 +243,29 @@ namespace ImStb
 #define IMGUI_DEBUG_LOG_CLIPPER(...)    do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventClipper)  IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 #define IMGUI_DEBUG_LOG_IO(...)         do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventIO)       IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 
+// Debug Allocation Sites for Metrics->Memory allocations. Enable with '#define IMGUI_DEBUG_ALLOC_SITES' in imconfig.h.
+// Allocations made while a IMGUI_DEBUG_ALLOC_SITE() scope is active are attributed to it (innermost scope wins).
+#if defined(IMGUI_DEBUG_ALLOC_SITES) && defined(IMGUI_DISABLE_DEBUG_TOOLS)
+#undef IMGUI_DEBUG_ALLOC_SITES
+#endif
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+#define IMGUI_DEBUG_ALLOC_SITE(_NAME)   ImGuiDebugAllocSiteScope debug_alloc_site_scope(_NAME)  // _NAME must be a string literal (pointer is stored)
+#else
+#define IMGUI_DEBUG_ALLOC_SITE(_NAME)   ((void)0)
+#endif
+
+// Frame Profiler zones for Metrics->Profiler. Enable with '#define IMGUI_ENABLE_PROFILER' in imconfig.h.
+// _NAME is copied into the profiler (ImGuiProfilerFrame::Names, ImGuiProfiler::ZoneStackNames): it may be a temporary string.
+#ifdef IMGUI_ENABLE_PROFILER
+#define IMGUI_PROFILE_SCOPE(_NAME)      ImGuiProfilerScope profiler_scope(_NAME)
+#define IMGUI_PROFILE_ZONE_BEGIN(_NAME) ImGui::ProfilerZoneBegin(_NAME)
+#define IMGUI_PROFILE_ZONE_END()        ImGui::ProfilerZoneEnd()
+#else
+#define IMGUI_PROFILE_SCOPE(_NAME)      ((void)0)
+#define IMGUI_PROFILE_ZONE_BEGIN(_NAME) ((void)0)
+#define IMGUI_PROFILE_ZONE_END()        ((void)0)
+#endif
+
 // Static Asserts
 #define IM_STATIC_ASSERT(_COND)         static_assert(_COND, "")
 
@@ -327,6 +358,8 @@ namespace ImStb
 // - Helpers: Hashing
 // - Helpers: Sorting
 // - Helpers: Bit manipulation
+// - Helpers: Atomics
+// - Helpers: Time
 // - Helpers: String
 // - Helpers: Formatting
 // - Helpers: UTF-8 <> wchar conversions
@@ -341,6 +374,7 @@ namespace ImStb
 // - Helper: ImSpan<>, ImSpanAllocator<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImRingBuffer<>
 // - Helper: ImGuiTextIndex
 //-----------------------------------------------------------------------------
 
@@ -361,6 +395,12 @@ static inline bool      ImIsPowerOfTwo(int v)           { return v != 0 && (v &
 static inline bool      ImIsPowerOfTwo(ImU64 v)         { return v != 0 && (v & (v - 1)) == 0; }
 static inline int       ImUpperPowerOfTwo(int v)        { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 
+// Helpers: Atomics
+IMGUI_API int           ImAtomicAdd(int* p, int v);                                         // Atomically add 'v' to '*p', return the new value.
+
+// Helpers: Time
+IMGUI_API ImU64         ImGetTimeNs();                                                      // Monotonic clock in nanoseconds (0 if not available on this platform). Not related to g.Time/io.DeltaTime.
+
 // Helpers: String
 IMGUI_API int           ImStricmp(const char* str1, const char* str2);                      // Case insensitive compare.
 IMGUI_API int           ImStrnicmp(const char* str1, const char* str2, size_t count);       // Case insensitive compare to a certain count.
@@ -658,6 +698,29 @@ struct ImSpanAllocator
     inline void  GetSpan(int n, ImSpan<T>* span)    { span->set((T*)GetSpanPtrBegin(n), (T*)GetSpanPtrEnd(n)); }
 };
 
+// Helper: ImFrameArena
+// Linear allocator for temporary data which doesn't outlive the current frame (see g.FrameArena, which is reset by NewFrame()).
+// - There is no individual free. Reset() makes all memory available again and invalidates all pointers returned by Alloc().
+// - Memory is kept across frames: when a frame needed more than one block, they are merged into a single block on Reset(),
+//   so frames with the same needs as a previous one don't allocate.
+// - Up to IM_FRAMEARENA_MAX_RETAINED_SIZE bytes are kept: above that Reset() frees everything, so a one-off large need
+//   (e.g. pasting a large text) doesn't stay allocated for the lifetime of the context.
+#define IM_FRAMEARENA_MAX_RETAINED_SIZE (256 * 1024)
+struct IMGUI_API ImFrameArena
+{
+    ImVector<char*> Blocks;                         // Blocks.back() is the current block. Extra blocks are only added while the first one is full.
+    ImVector<int>   BlocksSize;
+    int             CurrOff;                        // Offset in current block
+    int             UsedBytes;                      // Sum of allocations since last Reset()
+
+    ImFrameArena()                                  { CurrOff = UsedBytes = 0; }
+    ~ImFrameArena()                                 { ClearFreeMemory(); }
+    void*           Alloc(size_t sz);               // Return 16-bytes aligned memory
+    void            Reset();
+    void            ClearFreeMemory();
+    int             GetCapacityInBytes() const      { int sz = 0; for (int n = 0; n < BlocksSize.Size; n++) sz += BlocksSize[n]; return sz; }
+};
+
 // Helper: ImPool<>
 // Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
 // Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
@@ -717,6 +780,46 @@ struct ImChunkStream
     void    swap(ImChunkStream<T>& rhs) { rhs.Buf.swap(Buf); }
 };
 
+// Helper: ImChunkStreamIndex
+// Map from ImGuiID to an offset in a ImChunkStream<> (see offset_from_ptr()), to find entries by ID without walking all chunks.
+// Uses open addressing: unlike ImGuiStorage which keeps a sorted array, inserting keys in random order doesn't move existing entries.
+// Entries can't be removed individually: call Build() again after removing chunks. Key 0 is not indexed.
+struct IMGUI_API ImChunkStreamIndex
+{
+    ImVector<ImGuiID>   Keys;       // 0 == empty slot
+    ImVector<int>       Offsets;
+    int                 Count;
+
+    ImChunkStreamIndex()                    { Count = 0; }
+    void    Clear()                         { Keys.clear(); Offsets.clear(); Count = 0; }
+    int     GetOffset(ImGuiID key) const;   // Return -1 if not found
+    void    SetOffset(ImGuiID key, int offset);
+    template<typename T> void Build(ImChunkStream<T>& stream) { Clear(); for (T* p = stream.begin(); p != NULL; p = stream.next_chunk(p)) if (p->ID != 0) SetOffset(p->ID, stream.offset_from_ptr(p)); }
+};
+
+// Helper: ImRingBuffer<>
+// FIFO queue over a contiguous buffer: push_back() and pop_front() are O(1) and don't allocate while under capacity.
+// When full, push_back() grows the buffer (never dropping data) and unwraps it so that the head is back at index 0.
+// Only for POD types: no constructor/destructor are called.
+template<typename T>
+struct ImRingBuffer
+{
+    ImVector<T>     Buf;        // Storage. Buf.Size is the capacity.
+    int             Head;       // Index of first element in Buf
+    int             Size;       // Number of elements
+
+    ImRingBuffer()                              { Head = Size = 0; }
+    void        clear()                         { Head = Size = 0; }
+    bool        empty() const                   { return Size == 0; }
+    int         capacity() const                { return Buf.Size; }
+    T&          operator[](int i)               { IM_ASSERT(i >= 0 && i < Size); int idx = Head + i; if (idx >= Buf.Size) idx -= Buf.Size; return Buf.Data[idx]; }
+    const T&    operator[](int i) const         { IM_ASSERT(i >= 0 && i < Size); int idx = Head + i; if (idx >= Buf.Size) idx -= Buf.Size; return Buf.Data[idx]; }
+    T&          back()                          { return (*this)[Size - 1]; }
+    void        reserve(int new_capacity)       { if (new_capacity <= Buf.Size) return; ImVector<T> new_buf; new_buf.resize(new_capacity); for (int n = 0; n < Size; n++) new_buf.Data[n] = (*this)[n]; Buf.swap(new_buf); Head = 0; }
+    void        push_back(const T& v)           { if (Size == Buf.Size) reserve(Buf.Size ? Buf.Size * 2 : 8); int idx = Head + Size; if (idx >= Buf.Size) idx -= Buf.Size; Buf.Data[idx] = v; Size++; }
+    void        pop_front(int count = 1)        { IM_ASSERT(count >= 0 && count <= Size); Size -= count; Head = (Size == 0) ? 0 : (Head + count) % Buf.Size; }
+};
+
 // Helper: ImGuiTextIndex<>
 // Maintain a line index for a text buffer. This is a strong candidate to be moved into the public API.
 struct ImGuiTextIndex
@@ -760,6 +863,45 @@ struct ImGuiTextIndex
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Texels per pixel of baked circle outline textures (see ImFontAtlasFlags_NoBakedRoundCorners).
+#define IM_DRAWLIST_TEX_ROUND_CORNERS_STROKE_OVERSAMPLE         2
+
+// ImDrawList: Cache of auto-tessellated bezier curves, used by PathBezierCubicCurveTo()/PathBezierQuadraticCurveTo() when 'num_segments == 0'.
+// Keyed by control points and tessellation tolerance. Curves which haven't been used for IM_DRAWLIST_CURVE_CACHE_MAX_AGE frames are discarded.
+// Only active once NewFrame() has been called (ImGui::NewFrame() does it for the context's shared data), as it is responsible for the aging.
+#ifndef IM_DRAWLIST_CURVE_CACHE_MAX_AGE
+#define IM_DRAWLIST_CURVE_CACHE_MAX_AGE                         60
+#endif
+#ifndef IM_DRAWLIST_CURVE_CACHE_MAX_POINTS
+#define IM_DRAWLIST_CURVE_CACHE_MAX_POINTS                      (1 << 20) // Curves past that count are tessellated every frame until the next garbage collection.
+#endif
+
+struct ImDrawListCurveCacheEntry
+{
+    ImU32           Hash;
+    int             Degree;                     // 2 = quadratic, 3 = cubic
+    float           TessTol;
+    ImVec2          Ctrl[4];                    // Control points (Ctrl[3] is zero for quadratic curves)
+    int             PointsOffset;               // Offset in ImDrawListCurveCache::Points[]
+    int             PointsCount;
+    int             LastUsedFrame;
+};
+
+struct IMGUI_API ImDrawListCurveCache
+{
+    ImVector<ImDrawListCurveCacheEntry> Entries;
+    ImVector<ImVec2>    Points;                 // Flattened curves, excluding their first point
+    ImVector<int>       Buckets;                // Open addressing table of Entries[] index + 1 (0 = empty), size is a power of two
+    int                 FrameCount;
+    bool                Active;
+
+    ImDrawListCurveCache()                      { FrameCount = 0; Active = false; }
+    void                Clear();
+    void                NewFrame();
+    bool                Lookup(const ImVec2* ctrl, int degree, float tess_tol, ImVector<ImVec2>* out_path);
+    void                Store(const ImVec2* ctrl, int degree, float tess_tol, const ImVec2* points, int points_count);
+};
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -775,11 +917,16 @@ struct IMGUI_API ImDrawListSharedData
     // [Internal] Temp write buffer
     ImVector<ImVec2> TempBuffer;
 
+    // [Internal] Cache of flattened bezier curves
+    ImDrawListCurveCache CurveCache;
+
     // [Internal] Lookup tables
-    ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
+    const ImVec2*   ArcFastVtx;                 // Sample points on the circle (IM_DRAWLIST_ARCFAST_TABLE_SIZE entries). Immutable, shared by all instances.
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
     const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas
+    const ImVec4*   TexUvRoundCornersFilled;    // UV of anti-aliased filled quarter circles in the atlas
+    const ImVec4*   TexUvRoundCornersStroke;    // UV of anti-aliased quarter circle outlines in the atlas
 
     ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
@@ -1352,10 +1499,31 @@ struct ImGuiInputEvent
         ImGuiInputEventAppFocused   AppFocused;     // if Type == ImGuiInputEventType_Focus
     };
     bool                            AddedByTestEngine;
+    ImU64                           TimeNs;         // Value of ImGetTimeNs() when the event was submitted. Used to measure submission-to-processing latency.
 
     ImGuiInputEvent() { memset(this, 0, sizeof(*this)); }
 };
 
+// Initial capacity of the input event queue. Steady-state queueing doesn't allocate as long as this is not exceeded (it will grow if needed).
+#ifndef IMGUI_INPUT_EVENTS_QUEUE_CAPACITY
+#define IMGUI_INPUT_EVENTS_QUEUE_CAPACITY   256
+#endif
+
+// Input queue statistics (displayed in Metrics/Debugger->Inputs)
+// Latencies are measured with ImGetTimeNs() between the io.AddXXXEvent() call and the NewFrame() processing the event.
+struct ImGuiInputEventsStats
+{
+    int                             ProcessedCount;     // Number of events processed by last NewFrame()
+    int                             CoalescedCount;     // Number of events merged into an already queued event, before last NewFrame()
+    int                             CoalescedCountPending; // Number of events merged since last NewFrame(), copied into CoalescedCount by next NewFrame()
+    int                             CoalescedCountTotal;
+    float                           LatencyLast;        // Largest latency of events processed by last NewFrame() (in seconds)
+    float                           LatencyAvg;         // Exponential moving average of LatencyLast, over frames which processed events
+    float                           LatencyPeak;        // Largest latency seen so far
+
+    ImGuiInputEventsStats()         { memset(this, 0, sizeof(*this)); }
+};
+
 // Input function taking an 'ImGuiID owner_id' argument defaults to (ImGuiKeyOwner_Any == 0) aka don't test ownership, which matches legacy behavior.
 #define ImGuiKeyOwner_Any           ((ImGuiID)0)    // Accept key that have an owner, UNLESS a call to SetKeyOwner() explicitly used ImGuiInputFlags_LockThisFrame or ImGuiInputFlags_LockUntilRelease.
 #define ImGuiKeyOwner_None          ((ImGuiID)-1)   // Require key to have no owner.
@@ -1556,6 +1724,42 @@ struct ImGuiNavItemData
     void Clear()        { Window = NULL; ID = FocusScopeId = 0; InFlags = 0; SelectionUserData = -1; DistBox = DistCenter = DistAxial = FLT_MAX; }
 };
 
+// Storage for one navigable item retained by ImGuiNavItemIndex
+struct ImGuiNavItemIndexEntry
+{
+    ImGuiID             ID;
+    ImGuiID             FocusScopeId;
+    ImRect              RectRel;            // Nav rectangle in window relative space (after the clamping done by NavProcessItem())
+    ImGuiItemFlags      InFlags;
+    bool                IsMostlyVisible;    // Passed the visibility test used by ImGuiNavMoveFlags_AlsoScoreVisibleSet (PageUp/PageDown)
+    ImGuiSelectionUserData SelectionUserData;
+};
+
+// Main layer navigable items submitted to a window during last frame, bucketed by Y position.
+// Only recorded in windows with many navigable items. Used by NavUpdate() to resolve a directional move request
+// by scoring the few items surrounding the scoring rectangle, instead of scoring every item as it gets submitted.
+struct ImGuiNavItemIndex
+{
+    ImVector<ImGuiNavItemIndexEntry> Items; // Items in submission order
+    ImVector<int>       BucketStart;        // [BucketsCount + 1] offsets into BucketItems. Built lazily on first query when !IsSortedY.
+    ImVector<int>       BucketItems;        // Indices into Items, sorted by bucket (submission order is preserved within a bucket)
+    float               BucketMinY;         // Bucket 'n' holds items with RectRel.Min.y in [BucketMinY + n * BucketHeight, BucketMinY + (n + 1) * BucketHeight)
+    float               BucketMaxY;         // Last bucket extends to BucketMaxY
+    float               BucketHeight;
+    float               ItemsMaxHeight;
+    float               ItemsMinX;
+    float               ItemsMaxX;
+    int                 ItemsCount;         // Number of Main layer navigable items submitted this frame, counted even when not recording
+    int                 FrameCount;         // Frame when Items were recorded, -1 if not recording
+    ImU32               InterceptDirMask;   // Move directions which items may intercept during submission (e.g. Left/Right toggling the focused tree node). Resolving those requests early would skip that.
+    bool                IsRecording;
+    bool                IsSortedY;          // Items were submitted in increasing RectRel.Min.y order (common case), no need for buckets
+    bool                IsIncomplete;       // Items may be missing (e.g. a clipper was used in the window), so a better candidate may not have been recorded
+
+    ImGuiNavItemIndex() { memset(this, 0, sizeof(*this)); FrameCount = -1; }
+    void ClearFreeMemory() { Items.clear(); BucketStart.clear(); BucketItems.clear(); FrameCount = -1; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Typing-select support
 //-----------------------------------------------------------------------------
@@ -1680,13 +1884,16 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    ImDrawList*         DrawDataMergedList;     // Output of MergeDrawDataIntoSingleList() when io.ConfigDrawDataMerge is set
+    int                 DrawDataMergeListsCount;// Draw lists before merging (for Metrics)
+    int                 DrawDataMergeCmdsCount[2]; // Draw commands before (0) and after (1) merging (for Metrics)
     ImVec2              WorkOffsetMin;          // Work Area: Offset from Pos to top-left corner of Work Area. Generally (0,0) or (0,+main_menu_bar_height). Work Area is Full Area but without menu-bars/status-bars (so WorkArea always fit inside Pos/Size!)
     ImVec2              WorkOffsetMax;          // Work Area: Offset from Pos+Size to bottom-right corner of Work Area. Generally (0,0) or (0,-status_bar_height).
     ImVec2              BuildWorkOffsetMin;     // Work Area: Offset being built during current frame. Generally >= 0.0f.
     ImVec2              BuildWorkOffsetMax;     // Work Area: Offset being built during current frame. Generally <= 0.0f.
 
-    ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; }
-    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); }
+    ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; DrawDataMergedList = NULL; DrawDataMergeListsCount = DrawDataMergeCmdsCount[0] = DrawDataMergeCmdsCount[1] = 0; }
+    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); if (DrawDataMergedList) IM_DELETE(DrawDataMergedList); }
 
     // Calculate work rect pos/size given a set of offset (we have 1 pair of offset for rect locked from last frame data, and 1 pair for currently building rect)
     ImVec2  CalcWorkRectPos(const ImVec2& off_min) const                            { return ImVec2(Pos.x + off_min.x, Pos.y + off_min.y); }
@@ -1715,8 +1922,11 @@ struct ImGuiWindowSettings
     bool        IsChild;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
     bool        WantDelete;     // Set to invalidate/delete the settings entry
+    bool        WantWrite;      // Set when data changed since last text save: otherwise the text of this entry is copied from g.SettingsWindowsTextCache
+    int         TextCacheOffset; // Text of this entry in g.SettingsWindowsTextCache (valid when !WantWrite)
+    int         TextCacheSize;
 
-    ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
+    ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); WantWrite = true; }
     char* GetName()             { return (char*)(this + 1); }
 };
 
@@ -1730,7 +1940,14 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, const char* data, size_t data_size); // Read: Called with the output of WriteBinaryFn() when loading binary settings (optional)
+    void        (*WriteBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);   // Write: Output every entries into 'out_buf' when io.IniSavingBinary is set (optional, otherwise the output of WriteAllFn() is stored)
     void*       UserData;
+    bool        WriteOnlyWhenDirty; // Set by handlers which call MarkIniSettingsDirty(handler) on every change of their data: WriteAllFn()/WriteBinaryFn() are then only called after such change. Otherwise they are called on every save.
+
+    // [Internal] Incremental saving
+    bool            WantWrite;  // Set by MarkIniSettingsDirty(). When false (and WriteOnlyWhenDirty is set), the output of the previous save is reused.
+    ImGuiTextBuffer WriteCache; // Output of the last WriteAllFn()/WriteBinaryFn() call (only used when WriteOnlyWhenDirty is set)
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
@@ -1760,6 +1977,41 @@ struct ImGuiLocEntry
 };
 
 
+//-----------------------------------------------------------------------------
+// [SECTION] Garbage collection support
+//-----------------------------------------------------------------------------
+
+// Used/retained bytes of transient buffers (the ones freed by GcCompactTransientWindowBuffers(), TableGcCompactTransientBuffers(), TabBarGcCompactTransientBuffers())
+struct IMGUI_API ImGuiMemoryUsage
+{
+    size_t      UsedBytes;          // Bytes holding data (sum of ImVector<>::Size)
+    size_t      RetainedBytes;      // Bytes allocated (sum of ImVector<>::Capacity). Always >= UsedBytes.
+
+    ImGuiMemoryUsage()              { UsedBytes = RetainedBytes = 0; }
+    template<typename T> void       AddVector(const ImVector<T>& v) { UsedBytes += (size_t)v.Size * sizeof(T); RetainedBytes += (size_t)v.Capacity * sizeof(T); }
+    void                            AddDrawListSplitter(const ImDrawListSplitter& splitter);
+    void                            AddDrawList(const ImDrawList& draw_list);
+    void                            AddFrameArena(const ImFrameArena& arena) { UsedBytes += (size_t)arena.UsedBytes; RetainedBytes += (size_t)arena.GetCapacityInBytes(); }
+    void                            Add(const ImGuiMemoryUsage& other) { UsedBytes += other.UsedBytes; RetainedBytes += other.RetainedBytes; }
+};
+
+enum ImGuiGcObjectType
+{
+    ImGuiGcObjectType_Window,
+    ImGuiGcObjectType_Table,
+    ImGuiGcObjectType_TableTempData,
+    ImGuiGcObjectType_TabBar,
+};
+
+// An object not used during last frame, which transient buffers may be compacted when over io.ConfigMemoryCompactBudget
+struct ImGuiGcObject
+{
+    ImGuiGcObjectType   Type;
+    int                 Index;              // Index in g.Windows[], g.Tables.Buf[], g.TablesTempData[] or g.TabBars.Buf[]
+    float               LastTimeActive;     // Least recently used objects are compacted first
+    size_t              RetainedBytes;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Metrics, Debug Tools
 //-----------------------------------------------------------------------------
@@ -1787,15 +2039,46 @@ struct ImGuiDebugAllocEntry
     ImS16       FreeCount;
 };
 
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+#define IMGUI_DEBUG_ALLOC_SITES_MAX         64      // Maximum number of distinct sites. Further sites are accounted in the last one.
+#define IMGUI_DEBUG_ALLOC_SITES_FRAMES      60      // Size of sliding window (in frames)
+
+// Per-site allocation counters, over a sliding window of frames
+struct ImGuiDebugAllocSite
+{
+    const char* Name;
+    int         AllocCount[IMGUI_DEBUG_ALLOC_SITES_FRAMES];     // Indexed by (frame_count % IMGUI_DEBUG_ALLOC_SITES_FRAMES)
+    size_t      AllocBytes[IMGUI_DEBUG_ALLOC_SITES_FRAMES];
+    int         TotalAllocCount;
+    ImU64       TotalAllocBytes;
+};
+#endif
+
 struct ImGuiDebugAllocInfo
 {
     int         TotalAllocCount;            // Number of call to MemAlloc().
     int         TotalFreeCount;
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+    const char* SiteCurrent;                // Set by IMGUI_DEBUG_ALLOC_SITE(). NULL when outside of any site.
+    int         SitesCount;
+    int         SitesFrameCount[IMGUI_DEBUG_ALLOC_SITES_FRAMES];    // Frame number stored in each slot of the sliding window, to discard stale slots
+    ImGuiDebugAllocSite Sites[IMGUI_DEBUG_ALLOC_SITES_MAX];
+#endif
 
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+// Set current site for the lifetime of the scope. Use via IMGUI_DEBUG_ALLOC_SITE()
+struct IMGUI_API ImGuiDebugAllocSiteScope
+{
+    ImGuiDebugAllocInfo* Info;
+    const char* BackupSite;
+    ImGuiDebugAllocSiteScope(const char* name);
+    ~ImGuiDebugAllocSiteScope();
+};
+#endif
 
 struct ImGuiMetricsConfig
 {
@@ -1809,6 +2092,7 @@ struct ImGuiMetricsConfig
     bool        ShowAtlasTintedWithTextColor = false;
     int         ShowWindowsRectsType = -1;
     int         ShowTablesRectsType = -1;
+    char        EncodingViewerBuf[100] = {};        // Text input of 'Tools->UTF-8 Encoding viewer'
 };
 
 struct ImGuiStackLevelInfo
@@ -1835,6 +2119,62 @@ struct ImGuiIDStackTool
     ImGuiIDStackTool()      { memset(this, 0, sizeof(*this)); CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+#ifdef IMGUI_ENABLE_PROFILER
+#define IMGUI_PROFILER_FRAMES           32      // Number of frames kept in ring buffer
+#define IMGUI_PROFILER_ZONES_MAX        4096    // Maximum number of zones recorded per frame. Further zones are not recorded (but still forwarded to the hook).
+
+// Called on every zone begin/end, e.g. to forward zones to an external profiler. Set with ProfilerSetHook().
+typedef void (*ImGuiProfilerHookCallback)(ImGuiContext* ctx, const char* zone_name, bool zone_begin, void* user_data);
+
+struct ImGuiProfilerZone
+{
+    int                     NameOffset;                 // Copy of the name in frame Names[] (names such as window->Name may be reallocated during the frame)
+    ImU64                   TimeBegin;                  // In nanoseconds, from an arbitrary origin
+    ImU64                   TimeEnd;                    // == 0 while the zone is open
+    int                     Depth;
+};
+
+struct ImGuiProfilerStackEntry
+{
+    int                     NameOffset;                 // Copy of the name in profiler ZoneStackNames[]
+    int                     ZoneIdx;                    // Index in current frame Zones[], -1 if the zone is not recorded
+};
+
+// A frame spans from NewFrame() to the next NewFrame(), so it includes user code and rendering.
+struct ImGuiProfilerFrame
+{
+    int                     FrameCount;                 // -1 when unused
+    ImU64                   TimeBegin;
+    ImU64                   TimeEnd;                    // == 0 while the frame is being recorded
+    ImVector<ImGuiProfilerZone> Zones;                  // In order of begin calls: parents are stored before their children
+    ImGuiTextBuffer         Names;                      // Zero-terminated zone names
+
+    ImGuiProfilerFrame()    { FrameCount = -1; TimeBegin = TimeEnd = 0; }
+    const char*             GetZoneName(const ImGuiProfilerZone& zone) const { return Names.Buf.Data + zone.NameOffset; }
+};
+
+struct ImGuiProfiler
+{
+    bool                    Paused;                     // Don't record new frames (zones are still forwarded to the hook)
+    int                     FrameIdx;                   // Index of frame being recorded in Frames[], -1 if none
+    int                     DisplayFrameOffset;         // Metrics: frame to display, 0 == last complete frame
+    ImVector<ImGuiProfilerStackEntry> ZoneStack;        // Open zones
+    ImGuiTextBuffer         ZoneStackNames;             // Zero-terminated names of open zones
+    ImGuiProfilerFrame      Frames[IMGUI_PROFILER_FRAMES];
+    ImGuiProfilerHookCallback HookCallback;
+    void*                   HookUserData;
+
+    ImGuiProfiler()         { Paused = false; FrameIdx = -1; DisplayFrameOffset = 0; HookCallback = NULL; HookUserData = NULL; }
+};
+
+// Begin/end a zone for the lifetime of the scope. Use via IMGUI_PROFILE_SCOPE()
+struct IMGUI_API ImGuiProfilerScope
+{
+    ImGuiProfilerScope(const char* name);
+    ~ImGuiProfilerScope();
+};
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -1875,14 +2215,17 @@ struct ImGuiContext
     bool                    WithinFrameScopeWithImplicitWindow; // Set by NewFrame(), cleared by EndFrame() when the implicit debug window has been pushed
     bool                    WithinEndChild;                     // Set within EndChild()
     bool                    GcCompactAll;                       // Request full GC
+    ImGuiMemoryUsage        GcMemoryUsage;                      // Transient memory of all windows/tables/tab bars and frame arena, measured by GcUpdateMemoryBudget() when io.ConfigMemoryCompactBudget != 0
+    ImVector<ImGuiGcObject> GcObjects;                          // Temporary storage for GcUpdateMemoryBudget()
     bool                    TestEngineHookItems;                // Will call test engine hooks: ImGuiTestEngineHook_ItemAdd(), ImGuiTestEngineHook_ItemInfo(), ImGuiTestEngineHook_Log()
     void*                   TestEngine;                         // Test engine user data
 
     // Inputs
-    ImVector<ImGuiInputEvent> InputEventsQueue;                 // Input events which will be trickled/written into IO structure.
+    ImRingBuffer<ImGuiInputEvent> InputEventsQueue;             // Input events which will be trickled/written into IO structure.
     ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
+    ImGuiInputEventsStats   InputEventsStats;
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
@@ -1963,6 +2306,7 @@ struct ImGuiContext
     ImVector<ImGuiPopupData>    OpenPopupStack;                 // Which popups are open (persistent)
     ImVector<ImGuiPopupData>    BeginPopupStack;                // Which level of BeginPopup() we are in (reset every frame)
     ImVector<ImGuiNavTreeNodeData> NavTreeNodeStack;            // Stack for TreeNode() when a NavLeft requested is emitted.
+    ImVector<int>           NavItemIndexCandidates;             // Temporary storage for NavMoveRequestResolveWithItemIndex()
 
     int                     BeginMenuCount;
 
@@ -2063,6 +2407,7 @@ struct ImGuiContext
     // Tab bars
     ImGuiTabBar*                    CurrentTabBar;
     ImPool<ImGuiTabBar>             TabBars;
+    ImVector<float>                 TabBarsLastTimeActive;      // Last used timestamp of each tab bars (SOA, for efficient GC)
     ImVector<ImGuiPtrOrIndex>       CurrentTabBarStack;
     ImVector<ImGuiShrinkWidthItem>  ShrinkWidthBuffer;
 
@@ -2117,9 +2462,16 @@ struct ImGuiContext
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    bool                    SettingsIniDataBinary;              // SettingsIniData and handlers WriteCache were last written using the binary format
+    int                     SettingsWriteSnapshotIdx;           // Buffer last passed to io.WriteIniSettingsFn
+    ImVector<char>          SettingsWriteSnapshot[2];           // Immutable copies of .ini data passed to io.WriteIniSettingsFn (double-buffered)
+    ImGuiTextBuffer         SettingsWindowsTextCache;           // Text of each window entry from the last text save, so only entries which changed are formatted again
+    ImGuiTextBuffer         SettingsWindowsTextCacheNext;       // Built by the next text save, then swapped with SettingsWindowsTextCache
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImChunkStreamIndex                  SettingsWindowsIndex;   // ImGuiID -> offset in SettingsWindows (most recent entry for this ID)
+    ImChunkStreamIndex                  SettingsTablesIndex;    // ImGuiID -> offset in SettingsTables (most recent entry for this ID)
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2130,7 +2482,9 @@ struct ImGuiContext
     bool                    LogEnabled;                         // Currently capturing
     ImGuiLogType            LogType;                            // Capture target
     ImFileHandle            LogFile;                            // If != NULL log to stdout/ file
-    ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard. This is pointer so our GImGui static constructor doesn't call heap allocators.
+    char*                   LogFilename;                        // Copy of LogToFile() filename when using io.LogWriteFn (LogFile == NULL), points to LogFilenameBuf
+    ImVector<char>          LogFilenameBuf;                     // Storage for LogFilename, kept between logging sessions
+    ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard/buffer, write buffer when log to file/tty (see io.LogFlushThreshold).
     const char*             LogNextPrefix;
     const char*             LogNextSuffix;
     float                   LogLinePosY;
@@ -2151,6 +2505,9 @@ struct ImGuiContext
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this ID
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
     ImGuiDebugAllocInfo     DebugAllocInfo;
 
     // Misc
@@ -2162,6 +2519,7 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImFrameArena            FrameArena;                         // Temporary allocations which don't outlive the current frame (reset by NewFrame())
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
     {
@@ -2310,6 +2668,8 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsIniDataBinary = false;
+        SettingsWriteSnapshotIdx = 0;
         HookIdNext = 0;
 
         memset(LocalizationTable, 0, sizeof(LocalizationTable));
@@ -2318,6 +2678,7 @@ struct ImGuiContext
         LogType = ImGuiLogType_None;
         LogNextPrefix = LogNextSuffix = NULL;
         LogFile = NULL;
+        LogFilename = NULL;
         LogLinePosY = FLT_MAX;
         LogLineFirstItem = false;
         LogDepthRef = 0;
@@ -2494,6 +2855,7 @@ struct IMGUI_API ImGuiWindow
     ImRect                  NavRectRel[ImGuiNavLayer_COUNT];    // Reference rectangle, in window relative space
     ImVec2                  NavPreferredScoringPosRel[ImGuiNavLayer_COUNT]; // Preferred X/Y position updated when moving on a given axis, reset to FLT_MAX.
     ImGuiID                 NavRootFocusScopeId;                // Focus Scope ID at the time of Begin()
+    ImGuiNavItemIndex       NavItemIndex;                       // Navigable items from last frame, only recorded in windows with many items
 
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
@@ -2819,6 +3181,7 @@ struct IMGUI_API ImGuiTableTempData
 {
     int                         TableIndex;                 // Index in g.Tables.Buf[] pool
     float                       LastTimeActive;             // Last timestamp this structure was used
+    int                         LastFrameActive;            // Last frame number this structure was used
     float                       AngledheadersExtraWidth;    // Used in EndTable()
 
     ImVec2                      UserOuterSize;              // outer_size.x passed to BeginTable()
@@ -2833,7 +3196,7 @@ struct IMGUI_API ImGuiTableTempData
     float                       HostBackupItemWidth;        // Backup of OuterWindow->DC.ItemWidth at the end of BeginTable()
     int                         HostBackupItemWidthStackSize;//Backup of OuterWindow->DC.ItemWidthStack.Size at the end of BeginTable()
 
-    ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; }
+    ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; LastFrameActive = -1; }
 };
 
 // sizeof() ~ 12
@@ -2922,6 +3285,8 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList(ImGuiViewport* viewport);                     // get background draw list for the given viewport. this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
+    IMGUI_API bool          MergeDrawDataIntoSingleList(ImDrawData* draw_data, ImDrawList* out_list, bool allow_vtx_offset);
+    IMGUI_API void          PromoteDrawListToIdx32(ImDrawList* draw_list);
 
     // Init
     IMGUI_API void          Initialize();
@@ -2945,6 +3310,7 @@ namespace ImGui
     // Settings
     IMGUI_API void                  MarkIniSettingsDirty();
     IMGUI_API void                  MarkIniSettingsDirty(ImGuiWindow* window);
+    IMGUI_API void                  MarkIniSettingsDirty(ImGuiSettingsHandler* handler);
     IMGUI_API void                  ClearIniSettings();
     IMGUI_API void                  AddSettingsHandler(const ImGuiSettingsHandler* handler);
     IMGUI_API void                  RemoveSettingsHandler(const char* type_name);
@@ -3013,6 +3379,7 @@ namespace ImGui
     // Logging/Capture
     IMGUI_API void          LogBegin(ImGuiLogType type, int auto_open_depth);           // -> BeginCapture() when we design v2 api, for now stay under the radar by using the old name.
     IMGUI_API void          LogToBuffer(int auto_open_depth = -1);                      // Start logging/capturing to internal buffer
+    IMGUI_API void          LogFlush();                                                 // Write buffered output when logging to file/tty (automatically called, see io.LogFlushThreshold)
     IMGUI_API void          LogRenderedText(const ImVec2* ref_pos, const char* text, const char* text_end = NULL);
     IMGUI_API void          LogSetNextTextDecoration(const char* prefix, const char* suffix);
 
@@ -3235,6 +3602,8 @@ namespace ImGui
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTableTempData* table);
     IMGUI_API void          TableGcCompactSettings();
+    IMGUI_API void          TableGcCalcMemoryUsage(ImGuiTable* table, ImGuiMemoryUsage* out_usage);
+    IMGUI_API void          TableGcCalcMemoryUsage(ImGuiTableTempData* table, ImGuiMemoryUsage* out_usage);
 
     // Tables: Settings
     IMGUI_API void                  TableLoadSettings(ImGuiTable* table);
@@ -3259,6 +3628,8 @@ namespace ImGui
     IMGUI_API void          TabBarQueueReorder(ImGuiTabBar* tab_bar, ImGuiTabItem* tab, int offset);
     IMGUI_API void          TabBarQueueReorderFromMousePos(ImGuiTabBar* tab_bar, ImGuiTabItem* tab, ImVec2 mouse_pos);
     IMGUI_API bool          TabBarProcessReorder(ImGuiTabBar* tab_bar);
+    IMGUI_API void          TabBarGcCompactTransientBuffers(ImGuiTabBar* tab_bar);
+    IMGUI_API void          TabBarGcCalcMemoryUsage(ImGuiTabBar* tab_bar, ImGuiMemoryUsage* out_usage);
     IMGUI_API bool          TabItemEx(ImGuiTabBar* tab_bar, const char* label, bool* p_open, ImGuiTabItemFlags flags, ImGuiWindow* docked_window);
     IMGUI_API ImVec2        TabItemCalcSize(const char* label, bool has_close_button_or_unsaved_marker);
     IMGUI_API ImVec2        TabItemCalcSize(ImGuiWindow* window);
@@ -3352,6 +3723,7 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, const float* values, int values_count, int stride, ImGuiPlotLod* lod, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -3362,12 +3734,23 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcCalcWindowMemoryUsage(ImGuiWindow* window, ImGuiMemoryUsage* out_usage);
+    IMGUI_API void          GcCalcMemoryUsage(ImGuiMemoryUsage* out_usage, ImVector<ImGuiGcObject>* out_compactable_objects = NULL);
 
     // Debug Log
     IMGUI_API void          DebugLog(const char* fmt, ...) IM_FMTARGS(1);
     IMGUI_API void          DebugLogV(const char* fmt, va_list args) IM_FMTLIST(1);
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
 
+    // Frame Profiler (when IMGUI_ENABLE_PROFILER is defined). Prefer using the IMGUI_PROFILE_XXX() macros.
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          ProfilerNewFrame();
+    IMGUI_API void          ProfilerZoneBegin(const char* name);
+    IMGUI_API void          ProfilerZoneEnd();
+    IMGUI_API void          ProfilerSetHook(ImGuiProfilerHookCallback callback, void* user_data);
+    IMGUI_API ImU64         ProfilerGetTimeNs();
+#endif
+
     // Debug Tools
     IMGUI_API void          ErrorCheckEndFrameRecover(ImGuiErrorLogCallback log_callback, void* user_data = NULL);
     IMGUI_API void          ErrorCheckEndWindowRecover(ImGuiErrorLogCallback log_callback, void* user_data = NULL);
@@ -3382,6 +3765,12 @@ namespace ImGui
     IMGUI_API void          ShowFontAtlas(ImFontAtlas* atlas);
     IMGUI_API void          DebugHookIdInfo(ImGuiID id, ImGuiDataType data_type, const void* data_id, const void* data_id_end);
     IMGUI_API void          DebugNodeColumns(ImGuiOldColumns* columns);
+#ifdef IMGUI_DEBUG_ALLOC_SITES
+    IMGUI_API void          DebugNodeAllocSites(ImGuiDebugAllocInfo* info);
+#endif
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
     IMGUI_API void          DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, const ImDrawList* draw_list, const char* label);
     IMGUI_API void          DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, const ImDrawList* draw_list, const ImDrawCmd* draw_cmd, bool show_mesh, bool show_aabb);
     IMGUI_API void          DebugNodeFont(ImFont* font);
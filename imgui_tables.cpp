@@ -307,6 +307,7 @@ bool    ImGui::BeginTable(const char* str_id, int columns_count, ImGuiTableFlags
 
 bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImGuiTableFlags flags, const ImVec2& outer_size, float inner_width)
 {
+    IMGUI_DEBUG_ALLOC_SITE("Tables");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* outer_window = GetCurrentWindow();
     if (outer_window->SkipItems) // Consistent with other tables + beneficial side effect that assert on miscalling EndTable() will be more visible.
@@ -515,6 +516,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         g.TablesLastTimeActive.resize(table_idx + 1, -1.0f);
     g.TablesLastTimeActive[table_idx] = (float)g.Time;
     temp_data->LastTimeActive = (float)g.Time;
+    temp_data->LastFrameActive = g.FrameCount;
     table->MemoryCompacted = false;
 
     // Setup memory buffer (clear data if columns count changed)
@@ -613,6 +615,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
 // Unused channels don't perform their +2 allocations.
 void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
 {
+    IMGUI_DEBUG_ALLOC_SITE("Tables");
     // Allocate single buffer for our arrays
     const int columns_bit_array_size = (int)ImBitArrayGetStorageSizeInBytes(columns_count);
     ImSpanAllocator<6> span_allocator;
@@ -761,6 +764,7 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
 // Increase feedback side-effect with widgets relying on WorkRect.Max.x... Maybe provide a default distribution for _WidthAuto columns?
 void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
+    IMGUI_PROFILE_SCOPE("TableUpdateLayout");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(table->IsLayoutLocked == false);
 
@@ -1287,6 +1291,7 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
 
 void    ImGui::EndTable()
 {
+    IMGUI_PROFILE_SCOPE("EndTable");
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
@@ -2458,6 +2463,7 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 // This function is particularly tricky to understand.. take a breath.
 void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 {
+    IMGUI_PROFILE_SCOPE("TableMergeDrawChannels");
     ImGuiContext& g = *GImGui;
     ImDrawListSplitter* splitter = table->DrawSplitter;
     const bool has_freeze_v = (table->FreezeRowsCount > 0);
@@ -2641,6 +2647,7 @@ static ImU32 TableGetColumnBorderCol(ImGuiTable* table, int order_n, int column_
 // FIXME-TABLE: This is a mess, need to redesign how we render borders (as some are also done in TableEndRow)
 void ImGui::TableDrawBorders(ImGuiTable* table)
 {
+    IMGUI_PROFILE_SCOPE("TableDrawBorders");
     ImGuiWindow* inner_window = table->InnerWindow;
     if (!table->OuterWindow->ClipRect.Overlaps(table->OuterRect))
         return;
@@ -3443,18 +3450,20 @@ ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    if (id != 0)
+        g.SettingsTablesIndex.SetOffset(id, g.SettingsTables.offset_from_ptr(settings));
     return settings;
 }
 
 // Find existing settings
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset = g.SettingsTablesIndex.GetOffset(id);
+    if (offset == -1)
+        return NULL;
+    ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset);
+    return (settings->ID == id) ? settings : NULL; // Most recent entry for this ID may have been invalidated
 }
 
 // Get settings for a given table, NULL if none
@@ -3533,7 +3542,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
 
-    MarkIniSettingsDirty();
+    MarkIniSettingsDirty(FindSettingsHandler("Table"));
 }
 
 void ImGui::TableLoadSettings(ImGuiTable* table)
@@ -3608,6 +3617,7 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesIndex.Clear();
 }
 
 // Apply to existing windows (if any)
@@ -3622,13 +3632,8 @@ static void TableSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandle
         }
 }
 
-static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+static ImGuiTableSettings* TableSettingsHandler_ReadOpenByID(ImGuiID id, int columns_count)
 {
-    ImGuiID id = 0;
-    int columns_count = 0;
-    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
-        return NULL;
-
     if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id))
     {
         if (settings->ColumnsCountMax >= columns_count)
@@ -3641,6 +3646,15 @@ static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*,
     return ImGui::TableSettingsCreate(id, columns_count);
 }
 
+static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiID id = 0;
+    int columns_count = 0;
+    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
+        return NULL;
+    return TableSettingsHandler_ReadOpenByID(id, columns_count);
+}
+
 static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
 {
     // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
@@ -3708,6 +3722,92 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
     }
 }
 
+// Binary entries: one ImGuiTableSettingsBinaryEntry followed by ColumnsCount ImGuiTableColumnSettingsBinaryEntry.
+// Bump IMGUI_SETTINGS_BINARY_VERSION in imgui.cpp when changing.
+struct ImGuiTableSettingsBinaryEntry
+{
+    ImGuiID     ID;
+    ImS32       SaveFlags;
+    float       RefScale;
+    ImS32       ColumnsCount;
+};
+
+struct ImGuiTableColumnSettingsBinaryEntry
+{
+    float       WidthOrWeight;
+    ImGuiID     UserID;
+    ImS16       DisplayOrder;
+    ImS16       SortOrder;
+    ImU8        SortDirection;
+    ImU8        IsEnabled;
+    ImU8        IsStretch;
+    ImU8        Reserved;
+};
+
+static void TableSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, const char* data, size_t data_size)
+{
+    const char* data_end = data + data_size;
+    ImGuiTableSettingsBinaryEntry entry;
+    ImGuiTableColumnSettingsBinaryEntry column_entry;
+    while ((size_t)(data_end - data) >= sizeof(entry))
+    {
+        memcpy(&entry, data, sizeof(entry));
+        data += sizeof(entry);
+        if (entry.ColumnsCount <= 0 || entry.ColumnsCount > IMGUI_TABLE_MAX_COLUMNS || (size_t)(data_end - data) < entry.ColumnsCount * sizeof(column_entry))
+            break;
+        ImGuiTableSettings* settings = TableSettingsHandler_ReadOpenByID(entry.ID, entry.ColumnsCount);
+        settings->SaveFlags = entry.SaveFlags;
+        settings->RefScale = entry.RefScale;
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < entry.ColumnsCount; column_n++, column++, data += sizeof(column_entry))
+        {
+            memcpy(&column_entry, data, sizeof(column_entry));
+            column->Index = (ImGuiTableColumnIdx)column_n;
+            column->WidthOrWeight = column_entry.WidthOrWeight;
+            column->UserID = column_entry.UserID;
+            column->DisplayOrder = (ImGuiTableColumnIdx)column_entry.DisplayOrder;
+            column->SortOrder = (ImGuiTableColumnIdx)column_entry.SortOrder;
+            column->SortDirection = column_entry.SortDirection;
+            column->IsEnabled = column_entry.IsEnabled;
+            column->IsStretch = column_entry.IsStretch;
+        }
+    }
+}
+
+static void TableSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    buf->reserve(buf->size() + g.SettingsTables.size());
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        // Same filtering as TableSettingsHandler_WriteAll()
+        if (settings->ID == 0 || (settings->SaveFlags & (ImGuiTableFlags_Resizable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Sortable)) == 0)
+            continue;
+
+        ImGuiTableSettingsBinaryEntry entry;
+        entry.ID = settings->ID;
+        entry.SaveFlags = settings->SaveFlags;
+        entry.RefScale = settings->RefScale;
+        entry.ColumnsCount = settings->ColumnsCount;
+        buf->append((const char*)&entry, (const char*)(&entry + 1));
+
+        ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
+        {
+            ImGuiTableColumnSettingsBinaryEntry column_entry;
+            column_entry.WidthOrWeight = column->WidthOrWeight;
+            column_entry.UserID = column->UserID;
+            column_entry.DisplayOrder = column->DisplayOrder;
+            column_entry.SortOrder = column->SortOrder;
+            column_entry.SortDirection = (ImU8)column->SortDirection;
+            column_entry.IsEnabled = (ImU8)column->IsEnabled;
+            column_entry.IsStretch = (ImU8)column->IsStretch;
+            column_entry.Reserved = 0;
+            buf->append((const char*)&column_entry, (const char*)(&column_entry + 1));
+        }
+    }
+}
+
 void ImGui::TableSettingsAddSettingsHandler()
 {
     ImGuiSettingsHandler ini_handler;
@@ -3718,6 +3818,9 @@ void ImGui::TableSettingsAddSettingsHandler()
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadBinaryFn = TableSettingsHandler_ReadBinary;
+    ini_handler.WriteBinaryFn = TableSettingsHandler_WriteBinary;
+    ini_handler.WriteOnlyWhenDirty = true; // TableSaveSettings() marks the handler dirty
     AddSettingsHandler(&ini_handler);
 }
 
@@ -3727,6 +3830,7 @@ void ImGui::TableSettingsAddSettingsHandler()
 // - TableRemove() [Internal]
 // - TableGcCompactTransientBuffers() [Internal]
 // - TableGcCompactSettings() [Internal]
+// - TableGcCalcMemoryUsage() [Internal]
 //-------------------------------------------------------------------------
 
 // Remove Table (currently only used by TestEngine)
@@ -3779,6 +3883,19 @@ void ImGui::TableGcCompactSettings()
         if (settings->ID != 0)
             memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
     g.SettingsTables.swap(new_chunk_stream);
+    g.SettingsTablesIndex.Build(g.SettingsTables);
+}
+
+// Measure buffers freed by TableGcCompactTransientBuffers()
+void ImGui::TableGcCalcMemoryUsage(ImGuiTable* table, ImGuiMemoryUsage* out_usage)
+{
+    out_usage->AddVector(table->ColumnsNames.Buf);
+    out_usage->AddVector(table->SortSpecsMulti);
+}
+
+void ImGui::TableGcCalcMemoryUsage(ImGuiTableTempData* temp_data, ImGuiMemoryUsage* out_usage)
+{
+    out_usage->AddDrawListSplitter(temp_data->DrawSplitter);
 }
 
 
@@ -3820,6 +3937,9 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+    ImGuiMemoryUsage table_usage;
+    TableGcCalcMemoryUsage(table, &table_usage);
+    BulletText("Transient buffers: %d bytes used, %d bytes retained%s", (int)table_usage.UsedBytes, (int)table_usage.RetainedBytes, table->MemoryCompacted ? " (compacted)" : "");
     for (int n = 0; n < table->InstanceCurrent + 1; n++)
     {
         ImGuiTableInstanceData* table_instance = TableGetInstanceData(table, n);
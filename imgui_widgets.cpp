@@ -89,6 +89,7 @@ Index of this file:
 // Widgets
 static const float          DRAGDROP_HOLD_TO_OPEN_TIMER = 0.70f;    // Time for drag-hold to activate items accepting the ImGuiButtonFlags_PressedOnDragDropHold button behavior.
 static const float          DRAG_MOUSE_THRESHOLD_FACTOR = 0.50f;    // Multiplier for the default value of io.MouseDragThreshold to make DragFloat/DragInt react faster to mouse drags.
+static const int            PLOT_LOD_BLOCK_SHIFT = 5;               // ImGuiPlotLod::Levels[0] stores the min/max of blocks of 32 samples.
 
 // Those MIN/MAX values are not define because we need to point to them
 static const signed char    IM_S8_MIN  = -128;
@@ -3712,7 +3713,7 @@ static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)
 static ImWchar STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { IM_ASSERT(idx <= obj->CurLenW); return obj->TextW[idx]; }
 static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->TextW[line_start_idx + char_idx]; if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
 static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x200000 ? 0 : key; }
-static ImWchar STB_TEXTEDIT_NEWLINE = '\n';
+static const ImWchar STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
     const ImWchar* text = obj->TextW.Data;
@@ -4091,6 +4092,8 @@ void ImGui::InputTextDeactivateHook(ImGuiID id)
 //  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
 bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
 {
+    IMGUI_DEBUG_ALLOC_SITE("InputText");
+    IMGUI_PROFILE_SCOPE("InputText");
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -4549,10 +4552,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
                 const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
+                char* clipboard_data = (char*)g.FrameArena.Alloc(clipboard_data_len * sizeof(char));
                 ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
                 SetClipboardText(clipboard_data);
-                MemFree(clipboard_data);
             }
             if (is_cut)
             {
@@ -4568,7 +4570,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Filter pasted buffer
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len + 1) * sizeof(ImWchar));
+                ImWchar* clipboard_filtered = (ImWchar*)g.FrameArena.Alloc((clipboard_len + 1) * sizeof(ImWchar));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s != 0; )
                 {
@@ -4584,7 +4586,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     stb_textedit_paste(state, &state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
 
@@ -6211,6 +6212,8 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
     // For this purpose we essentially compare if g.NavIdIsAlive went from 0 to 1 between TreeNode() and TreePop().
     // It will become tempting to enable ImGuiTreeNodeFlags_NavLeftJumpsBackHere by default or move it to ImGuiStyle.
     // Currently only supports 32 level deep and we are fine with (1 << Depth) overflowing into a zero, easy to increase.
+    if (is_open && (flags & ImGuiTreeNodeFlags_NavLeftJumpsBackHere) && !(flags & ImGuiTreeNodeFlags_NoTreePushOnOpen))
+        window->NavItemIndex.InterceptDirMask |= (1 << ImGuiDir_Left);
     if (is_open && !g.NavIdIsAlive && (flags & ImGuiTreeNodeFlags_NavLeftJumpsBackHere) && !(flags & ImGuiTreeNodeFlags_NoTreePushOnOpen))
         if (g.NavMoveDir == ImGuiDir_Left && g.NavWindow == window && NavMoveRequestButNoResultYet())
         {
@@ -6289,6 +6292,8 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
                 toggled = true;
         }
 
+        if (g.NavId == id)
+            window->NavItemIndex.InterceptDirMask |= (1 << (is_open ? ImGuiDir_Left : ImGuiDir_Right)); // Move requests can't be resolved ahead of submission (see NavMoveRequestResolveWithItemIndex())
         if (g.NavId == id && g.NavMoveDir == ImGuiDir_Left && is_open)
         {
             toggled = true;
@@ -6970,6 +6975,7 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - ImGuiPlotLod
 //-------------------------------------------------------------------------
 // Plot/Graph widgets are not very good.
 // Consider writing your own, or using a third-party one, see:
@@ -6979,6 +6985,7 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 
 int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
 {
+    IMGUI_PROFILE_SCOPE("PlotEx");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -7107,6 +7114,11 @@ static float Plot_ArrayGetter(void* data, int idx)
     return v;
 }
 
+static inline float Plot_ArrayGetValue(const float* values, int stride, int idx)
+{
+    return *(const float*)(const void*)((const unsigned char*)values + (size_t)idx * stride);
+}
+
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
@@ -7129,6 +7141,250 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(const char* label, const float* values, int values_count, ImGuiPlotLod* lod, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
+{
+    PlotEx(ImGuiPlotType_Lines, label, values, values_count, stride, lod, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const float* values, int values_count, ImGuiPlotLod* lod, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
+{
+    PlotEx(ImGuiPlotType_Histogram, label, values, values_count, stride, lod, overlay_text, scale_min, scale_max, graph_size);
+}
+
+// Variant for very large arrays: each pixel column displays the min/max of the samples it covers, computed from the pyramid.
+// Arrays with fewer samples than twice the number of columns are passed to the regular PlotEx() with the scale computed from the pyramid.
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, const float* values, int values_count, int stride, ImGuiPlotLod* lod, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    IM_ASSERT(lod != NULL);
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    // Update pyramid with new samples, use its top level for auto-scale
+    lod->Build(values, values_count, stride);
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        float v_min = FLT_MAX, v_max = -FLT_MAX;
+        lod->CalcMinMax(values, 0, values_count, &v_min, &v_max, stride);
+        if (scale_min == FLT_MAX)
+            scale_min = v_min;
+        if (scale_max == FLT_MAX)
+            scale_max = v_max;
+    }
+
+    const ImGuiStyle& style = g.Style;
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
+    const int res_w = (int)(frame_size.x - style.FramePadding.x * 2.0f);
+    if (res_w <= 0 || values_count < res_w * 2)
+    {
+        ImGuiPlotArrayGetterData data(values, stride);
+        return PlotEx(plot_type, label, &Plot_ArrayGetter, (void*)&data, values_count, 0, overlay_text, scale_min, scale_max, size_arg);
+    }
+
+    const ImGuiID id = window->GetID(label);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return -1;
+    const bool hovered = ItemHoverable(frame_bb, id, g.LastItemData.InFlags);
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    // Column n covers samples [n * values_count / res_w, (n + 1) * values_count / res_w)
+    int column_hovered = -1;
+    if (hovered && inner_bb.Contains(g.IO.MousePos))
+        column_hovered = ImClamp((int)(g.IO.MousePos.x - inner_bb.Min.x), 0, res_w - 1);
+
+    const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+    const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);
+    const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+    const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+    const float y_zero = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+    ImVec2 pos_last(-FLT_MAX, 0.0f);
+    for (int n = 0; n < res_w; n++)
+    {
+        const int idx_begin = (int)((ImS64)n * values_count / res_w);
+        const int idx_end = (int)((ImS64)(n + 1) * values_count / res_w);
+        float v_min, v_max;
+        if (!lod->CalcMinMax(values, idx_begin, idx_end, &v_min, &v_max, stride))
+            continue;
+        const float x = inner_bb.Min.x + (float)n;
+        const float y_min = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_min - scale_min) * inv_scale));
+        const float y_max = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_max - scale_min) * inv_scale));
+        const ImU32 col = (n == column_hovered) ? col_hovered : col_base;
+        if (plot_type == ImGuiPlotType_Lines)
+        {
+            // Connect last sample of previous column to first sample of this column, then cover the min/max range of this column
+            float v_first = Plot_ArrayGetValue(values, stride, idx_begin);
+            float v_last = Plot_ArrayGetValue(values, stride, idx_end - 1);
+            v_first = (v_first != v_first) ? v_min : v_first; // NaN
+            v_last = (v_last != v_last) ? v_max : v_last;
+            const ImVec2 pos_first(x, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_first - scale_min) * inv_scale)));
+            if (pos_last.x != -FLT_MAX)
+                window->DrawList->AddLine(pos_last, pos_first, col);
+            if (y_min != y_max)
+                window->DrawList->AddLine(ImVec2(x, y_max), ImVec2(x, y_min), col);
+            pos_last = ImVec2(x, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_last - scale_min) * inv_scale)));
+        }
+        else if (plot_type == ImGuiPlotType_Histogram)
+        {
+            window->DrawList->AddRectFilled(ImVec2(x, ImMin(y_max, y_zero)), ImVec2(x + 1.0f, ImMax(y_min, y_zero)), col);
+        }
+    }
+
+    if (column_hovered != -1)
+    {
+        const int idx_begin = (int)((ImS64)column_hovered * values_count / res_w);
+        const int idx_end = (int)((ImS64)(column_hovered + 1) * values_count / res_w);
+        float v_min = 0.0f, v_max = 0.0f;
+        lod->CalcMinMax(values, idx_begin, idx_end, &v_min, &v_max, stride);
+        SetTooltip("%d..%d: %8.4g..%8.4g", idx_begin, idx_end - 1, v_min, v_max);
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+
+    // Return index of first sample of hovered column or -1 if none are hovered.
+    return (column_hovered != -1) ? (int)((ImS64)column_hovered * values_count / res_w) : -1;
+}
+
+// Min/max of samples [idx_begin, idx_end), ignoring NaN values. Contiguous arrays are scanned 4 samples at a time with SSE.
+static void PlotLod_ReduceMinMax(const float* values, int stride, int idx_begin, int idx_end, float* io_min, float* io_max)
+{
+    float v_min = *io_min;
+    float v_max = *io_max;
+    int idx = idx_begin;
+#ifdef IMGUI_ENABLE_SSE
+    if (stride == sizeof(float) && idx_end - idx >= 8)
+    {
+        __m128 v_min4 = _mm_set1_ps(v_min);
+        __m128 v_max4 = _mm_set1_ps(v_max);
+        for (; idx + 4 <= idx_end; idx += 4)
+        {
+            const __m128 v = _mm_loadu_ps(values + idx);
+            v_min4 = _mm_min_ps(v, v_min4); // Return the second operand when either is NaN
+            v_max4 = _mm_max_ps(v, v_max4);
+        }
+        float tmp_min[4], tmp_max[4];
+        _mm_storeu_ps(tmp_min, v_min4);
+        _mm_storeu_ps(tmp_max, v_max4);
+        for (int n = 0; n < 4; n++)
+        {
+            v_min = ImMin(v_min, tmp_min[n]);
+            v_max = ImMax(v_max, tmp_max[n]);
+        }
+    }
+#endif
+    for (; idx < idx_end; idx++)
+    {
+        const float v = Plot_ArrayGetValue(values, stride, idx);
+        v_min = (v < v_min) ? v : v_min; // Comparisons with NaN are false
+        v_max = (v > v_max) ? v : v_max;
+    }
+    *io_min = v_min;
+    *io_max = v_max;
+}
+
+ImGuiPlotLod::ImGuiPlotLod()
+{
+    LevelsCount = ValuesCount = 0;
+}
+
+void ImGuiPlotLod::Clear()
+{
+    for (int level_n = 0; level_n < IM_ARRAYSIZE(Levels); level_n++)
+        Levels[level_n].clear();
+    LevelsCount = ValuesCount = 0;
+}
+
+// Process samples [ValuesCount, values_count). The last block of each level may have been partial, it is recomputed.
+void ImGuiPlotLod::Build(const float* values, int values_count, int stride)
+{
+    IM_ASSERT(values_count >= 0);
+    if (values_count < ValuesCount)
+        Clear();
+    if (values_count == ValuesCount)
+        return;
+
+    int block_first = ValuesCount >> PLOT_LOD_BLOCK_SHIFT;
+    int blocks_count = (int)(((ImS64)values_count + (1 << PLOT_LOD_BLOCK_SHIFT) - 1) >> PLOT_LOD_BLOCK_SHIFT);
+    Levels[0].resize(blocks_count);
+    for (int block_n = block_first; block_n < blocks_count; block_n++)
+    {
+        float v_min = FLT_MAX, v_max = -FLT_MAX;
+        const int idx_end = (block_n + 1 < blocks_count) ? (block_n + 1) << PLOT_LOD_BLOCK_SHIFT : values_count;
+        PlotLod_ReduceMinMax(values, stride, block_n << PLOT_LOD_BLOCK_SHIFT, idx_end, &v_min, &v_max);
+        Levels[0].Data[block_n] = ImVec2(v_min, v_max);
+    }
+
+    // Levels[n + 1] blocks cover 2 blocks of Levels[n]
+    int level_n = 1;
+    for (; blocks_count > 1; level_n++)
+    {
+        IM_ASSERT(level_n < IM_ARRAYSIZE(Levels));
+        const ImVector<ImVec2>& children = Levels[level_n - 1];
+        ImVector<ImVec2>& level = Levels[level_n];
+        block_first >>= 1;
+        blocks_count = (blocks_count + 1) >> 1;
+        level.resize(blocks_count);
+        for (int block_n = block_first; block_n < blocks_count; block_n++)
+        {
+            ImVec2 v = children.Data[block_n * 2];
+            if (block_n * 2 + 1 < children.Size)
+                v = ImVec2(ImMin(v.x, children.Data[block_n * 2 + 1].x), ImMax(v.y, children.Data[block_n * 2 + 1].y));
+            level.Data[block_n] = v;
+        }
+    }
+    LevelsCount = level_n;
+    ValuesCount = values_count;
+}
+
+// Samples not aligned on a block are scanned, aligned blocks are combined from the largest levels covering them: O(log N).
+bool ImGuiPlotLod::CalcMinMax(const float* values, int idx_begin, int idx_end, float* out_min, float* out_max, int stride) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= ValuesCount);
+    float v_min = FLT_MAX, v_max = -FLT_MAX;
+    const int block_size = 1 << PLOT_LOD_BLOCK_SHIFT;
+    if (idx_end - idx_begin < block_size * 2)
+    {
+        PlotLod_ReduceMinMax(values, stride, idx_begin, idx_end, &v_min, &v_max);
+    }
+    else
+    {
+        int block_begin = (int)(((ImS64)idx_begin + block_size - 1) >> PLOT_LOD_BLOCK_SHIFT);
+        int block_end = idx_end >> PLOT_LOD_BLOCK_SHIFT;
+        PlotLod_ReduceMinMax(values, stride, idx_begin, block_begin << PLOT_LOD_BLOCK_SHIFT, &v_min, &v_max);
+        PlotLod_ReduceMinMax(values, stride, block_end << PLOT_LOD_BLOCK_SHIFT, idx_end, &v_min, &v_max);
+        for (int level_n = 0; block_begin < block_end; level_n++, block_begin >>= 1, block_end >>= 1)
+        {
+            const ImVec2* level = Levels[level_n].Data;
+            if (block_begin & 1)
+            {
+                v_min = ImMin(v_min, level[block_begin].x);
+                v_max = ImMax(v_max, level[block_begin].y);
+                block_begin++;
+            }
+            if (block_end & 1)
+            {
+                block_end--;
+                v_min = ImMin(v_min, level[block_end].x);
+                v_max = ImMax(v_max, level[block_end].y);
+            }
+        }
+    }
+    *out_min = v_min;
+    *out_max = v_max;
+    return v_min <= v_max;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
@@ -7492,6 +7748,8 @@ bool ImGui::BeginMenuEx(const char* label, const char* icon, bool enabled)
 
     bool want_open = false;
     bool want_close = false;
+    if (g.NavId == id)
+        window->NavItemIndex.InterceptDirMask |= (1 << ((window->DC.LayoutType == ImGuiLayoutType_Vertical) ? ImGuiDir_Right : ImGuiDir_Down)); // Nav-Right/Nav-Down to open, see below
     if (window->DC.LayoutType == ImGuiLayoutType_Vertical) // (window->Flags & (ImGuiWindowFlags_Popup|ImGuiWindowFlags_ChildMenu))
     {
         // Close menu when not hovering it anymore unless we are moving roughly in the direction of the menu
@@ -7734,6 +7992,8 @@ bool ImGui::MenuItem(const char* label, const char* shortcut, bool* p_selected,
 // - TabBarProcessReorder() [Internal]
 // - TabBarScrollingButtons() [Internal]
 // - TabBarTabListPopupButton() [Internal]
+// - TabBarGcCompactTransientBuffers() [Internal]
+// - TabBarGcCalcMemoryUsage() [Internal]
 //-------------------------------------------------------------------------
 
 struct ImGuiTabBarSection
@@ -7854,6 +8114,15 @@ bool    ImGui::BeginTabBarEx(ImGuiTabBar* tab_bar, const ImRect& tab_bar_bb, ImG
     tab_bar->WantLayout = true; // Layout will be done on the first call to ItemTab()
     tab_bar->PrevFrameVisible = tab_bar->CurrFrameVisible;
     tab_bar->CurrFrameVisible = g.FrameCount;
+
+    // Mark as used to avoid GC
+    if (g.TabBars.Contains(tab_bar))
+    {
+        const int tab_bar_idx = g.TabBars.GetIndex(tab_bar);
+        if (tab_bar_idx >= g.TabBarsLastTimeActive.Size)
+            g.TabBarsLastTimeActive.resize(tab_bar_idx + 1, -1.0f);
+        g.TabBarsLastTimeActive[tab_bar_idx] = (float)g.Time;
+    }
     tab_bar->PrevTabsContentsHeight = tab_bar->CurrTabsContentsHeight;
     tab_bar->CurrTabsContentsHeight = 0.0f;
     tab_bar->ItemSpacingY = g.Style.ItemSpacing.y;
@@ -8476,6 +8745,29 @@ static ImGuiTabItem* ImGui::TabBarTabListPopupButton(ImGuiTabBar* tab_bar)
     return tab_to_select;
 }
 
+// Free up/compact tab bar buffers for when it gets unused.
+// Tabs[] holds persistent state (order, widths, last selection..) so we only shrink it to fit. Names are re-submitted every frame anyway.
+void ImGui::TabBarGcCompactTransientBuffers(ImGuiTabBar* tab_bar)
+{
+    ImGuiContext& g = *GImGui;
+    for (ImGuiTabItem& tab : tab_bar->Tabs)
+        tab.NameOffset = -1;
+    tab_bar->TabsNames.Buf.clear();
+    if (tab_bar->Tabs.Capacity > tab_bar->Tabs.Size)
+    {
+        ImVector<ImGuiTabItem> tabs = tab_bar->Tabs;
+        tab_bar->Tabs.swap(tabs);
+    }
+    g.TabBarsLastTimeActive[g.TabBars.GetIndex(tab_bar)] = -1.0f;
+}
+
+// Measure buffers freed by TabBarGcCompactTransientBuffers()
+void ImGui::TabBarGcCalcMemoryUsage(ImGuiTabBar* tab_bar, ImGuiMemoryUsage* out_usage)
+{
+    out_usage->AddVector(tab_bar->Tabs);
+    out_usage->AddVector(tab_bar->TabsNames.Buf);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: BeginTabItem, EndTabItem, etc.
 //-------------------------------------------------------------------------
@@ -459,6 +459,7 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         ImFontConfig& cfg = atlas->ConfigData[src_i];
         FreeTypeFont& font_face = src_tmp.Font;
         IM_ASSERT(cfg.DstFont && (!cfg.DstFont->IsLoaded() || cfg.DstFont->ContainerAtlas == atlas));
+        IM_ASSERT(!cfg.SDF && "ImFontConfig::SDF is only supported by the stb_truetype builder.");
 
         // Find index from cfg.DstFont (we allow the user to set cfg.DstFont. Also it makes casual debugging nicer than when storing indices)
         src_tmp.DstIndex = -1;
@@ -818,8 +819,7 @@ static bool ImFontAtlasBuildWithFreeType(ImFontAtlas* atlas)
 
 const ImFontBuilderIO* ImGuiFreeType::GetBuilderForFreeType()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithFreeType;
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithFreeType };
     return &io;
 }
 